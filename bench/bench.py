@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""
+Benchmark do compilador e das VMs (make bench)
+
+Para cada caso, gera um programa com bench/gerar_programa.py e mede:
+- as fases do moneyc (`--time-phases`): léxico, yyparse (que também chama o
+  scanner), otimização e generate_assembly, em ms, e os tokens por segundo
+  do scanner sozinho;
+- o tempo de cada VM disponível (bin/bankvm, vm/bankvm.py e o executável do
+  backend C) executando o assembly, e instruções por segundo, com o número
+  de instruções contado por `bankvm --profile`.
+
+Com --lexico só o compilador é medido. Cada medida é a melhor de
+--repeticoes execuções. Os resultados vão para
+build/bench/resultados.json; com --base=<resultados anteriores> o resumo
+também mostra a variação em relação a eles.
+"""
+
+import argparse
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+GENERATOR = os.path.join(ROOT, 'bench', 'gerar_programa.py')
+COMPILER = os.path.join(ROOT, 'bin', 'moneyc')
+NATIVE_VM = os.path.join(ROOT, 'bin', 'bankvm')
+PYTHON_VM = os.path.join(ROOT, 'vm', 'bankvm.py')
+
+# nome, parâmetros do gerador e VMs que não rodam o caso: a VM Python é
+# ~100x mais lenta, e o gcc -O2 leva minutos com um main() de 1M comandos
+CASES = [
+    ('basico', ['--contas', '8', '--comandos', '50', '--laco', '2', '--iteracoes', '100'], set()),
+    ('expressoes', ['--contas', '4', '--comandos', '20', '--expr', '30', '--laco', '1',
+                    '--iteracoes', '2000'], set()),
+    ('strings', ['--comandos', '40', '--impressoes', '0.5', '--laco', '1', '--iteracoes', '500'], set()),
+    ('lacos_aninhados', ['--comandos', '5', '--laco', '6', '--iteracoes', '8'], {'python'}),
+    ('contas', ['--contas', '5000', '--variaveis', '1000', '--comandos', '20000'], set()),
+    ('um_milhao_de_linhas', ['--comandos', '1000000'], {'python', 'c'}),
+    ('se_aninhados', ['--comandos', '10', '--se-aninhados', '1000'], set()),
+]
+
+# --rapido divide por 10 estes parâmetros
+QUICK_SCALED = {'--comandos', '--iteracoes', '--contas', '--variaveis'}
+
+PHASES = ('léxico', 'sintático', 'otimização', 'geração')
+
+
+def best_time(command, repeat: int, stdout=subprocess.DEVNULL) -> float:
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        subprocess.run(command, stdout=stdout, stderr=subprocess.DEVNULL, check=True)
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def compile_phases(source: str, asm: str, repeat: int) -> tuple:
+    """Menor tempo de cada fase do moneyc, em ms, e o número de tokens"""
+    best = {}
+    for _ in range(repeat):
+        result = subprocess.run([COMPILER, '--time-phases', source, '-o', asm],
+                                capture_output=True, text=True, check=True)
+        times = dict(re.findall(r'(\w+)=([0-9.]+)', result.stderr))
+        for phase in PHASES:
+            value = float(times[phase])
+            best[phase] = min(best.get(phase, value), value)
+        tokens = int(re.search(r'Léxico: ([0-9]+) tokens', result.stderr).group(1))
+    return best, tokens
+
+
+def count_instructions(asm: str) -> int:
+    result = subprocess.run([NATIVE_VM, asm, '--profile'], stdout=subprocess.DEVNULL,
+                            stderr=subprocess.PIPE, text=True, check=True)
+    return int(re.search(r'Perfil de execução: ([0-9]+) instruções', result.stderr).group(1))
+
+
+def run_case(name: str, params: list, skipped: set, args, workdir: str) -> dict:
+    if args.rapido:
+        params = [str(max(1, int(value) // 10)) if i > 0 and params[i - 1] in QUICK_SCALED else value
+                  for i, value in enumerate(params)]
+    source = os.path.join(workdir, f'{name}.money')
+    asm = os.path.join(workdir, f'{name}.asm')
+    subprocess.run([sys.executable, GENERATOR, *params, '-o', source], check=True)
+    with open(source, 'rb') as f:
+        data = f.read()
+
+    phases, tokens = compile_phases(source, asm, args.repeticoes)
+    result = {
+        'caso': name,
+        'parametros': ' '.join(params),
+        'linhas': data.count(b'\n'),
+        'bytes': len(data),
+        'fases_ms': phases,
+        'tokens': tokens,
+        'tokens_por_segundo': round(tokens / phases['léxico'] * 1e3) if phases['léxico'] > 0 else None,
+    }
+    if args.lexico:
+        return result
+    instructions = count_instructions(asm)
+    result['instrucoes'] = instructions
+
+    vms = {'nativa': [NATIVE_VM, asm]}
+    if 'python' not in skipped and not args.sem_python:
+        vms['python'] = [sys.executable, PYTHON_VM, asm]
+    if 'c' not in skipped and shutil.which(args.cc):
+        c_file = os.path.join(workdir, f'{name}.c')
+        executable = os.path.join(workdir, f'{name}.native')
+        subprocess.run([COMPILER, source, '--emit=c', '-o', c_file], check=True)
+        subprocess.run([args.cc, '-O2', '-o', executable, c_file, '-lm'], check=True)
+        vms['c'] = [executable]
+    result['vms'] = {}
+    for vm, command in vms.items():
+        seconds = best_time(command, args.repeticoes)
+        result['vms'][vm] = {
+            'segundos': round(seconds, 6),
+            'instrucoes_por_segundo': round(instructions / seconds) if seconds > 0 else None,
+        }
+    return result
+
+
+def change(value, base) -> str:
+    if not base:
+        return ''
+    return f' ({100.0 * (value - base) / base:+.1f}%)'
+
+
+def print_summary(results: list, base: dict):
+    for result in results:
+        previous = base.get(result['caso'], {})
+        phases = result['fases_ms']
+        executed = f", {result['instrucoes']} instruções" if 'instrucoes' in result else ''
+        print(f"{result['caso']}: {result['linhas']} linhas, {result['tokens']} tokens{executed}")
+        print('  moneyc (ms): ' + ', '.join(
+            f"{phase} {phases[phase]:.3f}{change(phases[phase], previous.get('fases_ms', {}).get(phase))}"
+            for phase in PHASES))
+        tps = result['tokens_por_segundo'] or 0
+        print(f"   léxico: {tps / 1e6:.2f} M tokens/s{change(tps, previous.get('tokens_por_segundo'))}")
+        for vm, measure in result.get('vms', {}).items():
+            old = previous.get('vms', {}).get(vm, {}).get('instrucoes_por_segundo')
+            ips = measure['instrucoes_por_segundo']
+            print(f"  {vm:>7}: {measure['segundos']:.3f} s, {ips / 1e6:.2f} M instruções/s{change(ips, old)}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Benchmark do moneyc e das VMs')
+    parser.add_argument('casos', nargs='*', help=f'Casos a executar (padrão: todos: '
+                        f'{", ".join(name for name, _, _ in CASES)})')
+    parser.add_argument('--repeticoes', type=int, default=3, metavar='N',
+                        help='Execuções de cada medida; vale a menor (padrão: 3)')
+    parser.add_argument('--rapido', action='store_true', help='Programas 10x menores')
+    parser.add_argument('--sem-python', action='store_true', help='Não medir a VM Python')
+    parser.add_argument('--lexico', action='store_true', help='Medir só o compilador, sem as VMs')
+    parser.add_argument('--saida', default=os.path.join(ROOT, 'build', 'bench', 'resultados.json'),
+                        metavar='JSON', help='Arquivo de resultados (padrão: build/bench/resultados.json)')
+    parser.add_argument('--base', metavar='JSON', help='Resultados anteriores para comparação')
+    parser.add_argument('--cc', default=os.environ.get('CC', 'cc'), help='Compilador C do backend C')
+    args = parser.parse_args()
+
+    names = [name for name, _, _ in CASES]
+    unknown = [name for name in args.casos if name not in names]
+    if unknown or args.repeticoes < 1:
+        parser.error(f'caso desconhecido: {", ".join(unknown)}' if unknown else '--repeticoes deve ser positivo')
+    for path in (COMPILER,) if args.lexico else (COMPILER, NATIVE_VM):
+        if not os.access(path, os.X_OK):
+            print(f"Erro: '{path}' não encontrado; execute 'make' primeiro", file=sys.stderr)
+            sys.exit(1)
+    base = {}
+    if args.base:
+        with open(args.base, encoding='utf-8') as f:
+            base = {result['caso']: result for result in json.load(f)['resultados']}
+
+    workdir = os.path.dirname(os.path.abspath(args.saida))
+    os.makedirs(workdir, exist_ok=True)
+    results = []
+    for name, params, skipped in CASES:
+        if args.casos and name not in args.casos:
+            continue
+        print(f'[{name}] ...', file=sys.stderr)
+        results.append(run_case(name, params, skipped, args, workdir))
+
+    report = {
+        'maquina': platform.machine(),
+        'sistema': platform.platform(),
+        'data': time.strftime('%Y-%m-%dT%H:%M:%S'),
+        'repeticoes': args.repeticoes,
+        'rapido': args.rapido,
+        'lexico': args.lexico,
+        'resultados': results,
+    }
+    with open(args.saida, 'w', encoding='utf-8') as out:
+        json.dump(report, out, ensure_ascii=False, indent=2)
+        out.write('\n')
+    print_summary(results, base)
+    print(f'Resultados gravados em {os.path.relpath(args.saida)}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Gerador de programas MoneyLang sintéticos para o benchmark (make bench)
+
+O programa declara N contas, algumas variáveis e M comandos aleatórios
+(depósitos, saques, transferências, juros, atribuições e impressões),
+opcionalmente dentro de laços `enquanto` aninhados e seguidos de blocos `se`
+aninhados. A mesma semente gera sempre o mesmo programa.
+"""
+
+import argparse
+import random
+import sys
+
+INDENT = '    '
+TEXT = 'Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período'
+
+
+class Generator:
+    def __init__(self, args):
+        self.args = args
+        self.random = random.Random(args.semente)
+        self.accounts = [f'c{i}' for i in range(args.contas)]
+        self.variables = [f'v{i}' for i in range(args.variaveis)]
+        self.counters = [f'i{i}' for i in range(args.laco)]
+        self.lines = []
+
+    def emit(self, depth: int, text: str):
+        self.lines.append(INDENT * depth + text)
+
+    def atom(self) -> str:
+        kind = self.random.randrange(4)
+        if kind == 0:
+            return self.random.choice(self.accounts)
+        if kind == 1 and self.variables:
+            return self.random.choice(self.variables)
+        if kind == 2 and self.counters:
+            return self.random.choice(self.counters)
+        return str(self.random.randint(1, 99))
+
+    def expression(self, depth: int, bound: int) -> str:
+        """Expressão com `depth` operadores aninhados, reduzida a [0, bound)
+
+        Nunca divide por zero, e o resto limita o valor: sem ele os saldos
+        cresceriam exponencialmente até inf e NaN em programas longos.
+        """
+        text = self.atom()
+        for _ in range(depth):
+            op = self.random.randrange(4)
+            if op == 0:
+                text = f'({text} + {self.atom()})'
+            elif op == 1:
+                text = f'({text} - {self.atom()})'
+            elif op == 2:
+                text = f'({text} * 0.5)'
+            else:
+                text = f'({text} / 2)'
+        return f'{text} % {bound}'
+
+    def statement(self) -> str:
+        if self.random.random() < self.args.impressoes:
+            return f'mostrar("{TEXT}", {self.random.choice(self.accounts)})'
+        kind = self.random.randrange(6)
+        account = self.random.choice(self.accounts)
+        if kind == 0:
+            return f'depositar({account}, {self.expression(self.args.expr, 97)})'
+        if kind == 1:
+            return f'sacar({account}, {self.random.randint(1, 9)})'
+        if kind == 2 and len(self.accounts) > 1:
+            target = self.random.choice([a for a in self.accounts if a != account])
+            return f'transferir({account}, {target}, {self.random.randint(1, 9)})'
+        if kind == 3:
+            return f'aplicar_juros({account}, 0.001)'
+        if self.variables:
+            return f'{self.random.choice(self.variables)} = {self.expression(self.args.expr, 1000)}'
+        return f'depositar({account}, {self.expression(self.args.expr, 97)})'
+
+    def loop(self, level: int):
+        counter = self.counters[level]
+        self.emit(level, f'{counter} = {self.args.iteracoes}')
+        self.emit(level, f'enquanto ({counter} > 0)')
+        if level + 1 < len(self.counters):
+            self.loop(level + 1)
+        else:
+            for _ in range(self.args.comandos):
+                self.emit(level + 1, self.statement())
+        self.emit(level + 1, f'{counter} = {counter} - 1')
+
+    def program(self) -> str:
+        self.emit(0, f'# Programa sintético: {" ".join(sys.argv[1:])}')
+        for account in self.accounts:
+            self.emit(0, f'conta {account} = {self.random.randint(100, 10000)}')
+        for variable in self.variables:
+            self.emit(0, f'{variable} = {self.random.randint(0, 99)}')
+        if self.counters:
+            self.loop(0)
+        else:
+            for _ in range(self.args.comandos):
+                self.emit(0, self.statement())
+        for depth in range(self.args.se_aninhados):
+            self.emit(depth, f'se ({self.random.choice(self.accounts)} > -1)')
+            self.emit(depth + 1, f'depositar({self.random.choice(self.accounts)}, 1)')
+        self.emit(0, f'mostrar("Saldo final:", {self.accounts[0]})')
+        return '\n'.join(self.lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Gera um programa MoneyLang sintético')
+    parser.add_argument('-o', '--saida', help='Arquivo .money de saída (padrão: saída padrão)')
+    parser.add_argument('--contas', type=int, default=8, metavar='N', help='Contas declaradas (padrão: 8)')
+    parser.add_argument('--variaveis', type=int, default=4, metavar='N', help='Variáveis (padrão: 4)')
+    parser.add_argument('--comandos', type=int, default=100, metavar='M',
+                        help='Comandos no corpo do laço mais interno, ou do programa sem laços (padrão: 100)')
+    parser.add_argument('--laco', type=int, default=0, metavar='P', help='Laços aninhados (padrão: 0)')
+    parser.add_argument('--iteracoes', type=int, default=10, metavar='K',
+                        help='Iterações de cada laço (padrão: 10)')
+    parser.add_argument('--expr', type=int, default=2, metavar='P',
+                        help='Operadores aninhados em cada expressão (padrão: 2)')
+    parser.add_argument('--impressoes', type=float, default=0.0, metavar='F',
+                        help='Fração dos comandos que são mostrar() com texto longo (padrão: 0)')
+    parser.add_argument('--se-aninhados', type=int, default=0, metavar='P',
+                        help='Blocos se aninhados no fim do programa (padrão: 0)')
+    parser.add_argument('--semente', type=int, default=1, help='Semente do gerador (padrão: 1)')
+    args = parser.parse_args()
+    if args.contas < 1 or min(args.variaveis, args.comandos, args.laco, args.iteracoes, args.expr,
+                               args.se_aninhados) < 0 or not 0.0 <= args.impressoes <= 1.0:
+        parser.error('parâmetros inválidos')
+
+    text = Generator(args).program()
+    if args.saida:
+        with open(args.saida, 'w', encoding='utf-8') as out:
+            out.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
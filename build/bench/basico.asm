@@ -0,0 +1,78 @@
+# BankVM assembly generated by MoneyLang compiler
+LINE 2
+ACCOUNT_INIT c0
+PUSH_CONST 2301
+STORE c0
+LINE 3
+PUSH_CONST 72
+STORE v0
+LINE 4
+PUSH_CONST 97
+STORE v1
+LINE 5
+PUSH_CONST 8
+STORE v2
+LINE 6
+PUSH_CONST 32
+STORE v3
+LINE 7
+PUSH_CONST 10
+STORE i0
+LABEL loop_0
+LINE 8
+LOAD i0
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_1
+LINE 9
+PUSH_CONST 10
+STORE i1
+LABEL loop_2
+LINE 10
+LOAD i1
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_3
+LINE 11
+PUSH_CONST 0.001
+APPLY_INTEREST c0
+LINE 12
+PUSH_CONST 8
+WITHDRAW c0
+LINE 13
+PUSH_CONST 0.001
+APPLY_INTEREST c0
+LINE 14
+LOAD i0
+LOAD i0
+ADD
+LOAD c0
+ADD
+PUSH_CONST 97
+MOD
+DEPOSIT c0
+LINE 15
+PUSH_CONST 0.001
+APPLY_INTEREST c0
+LINE 16
+LOAD i1
+PUSH_CONST 1
+SUB
+STORE i1
+LINE 10
+JMP loop_2
+LABEL endloop_3
+LINE 17
+LOAD i0
+PUSH_CONST 1
+SUB
+STORE i0
+LINE 8
+JMP loop_0
+LABEL endloop_1
+LINE 18
+PRINT_STR_LITERAL "Saldo final:"
+LOAD c0
+PRINT
+LINE 0
+HALT
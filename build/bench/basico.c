@@ -0,0 +1,89 @@
+/* Generated by moneyc --emit=c; build with: cc -O2 programa.c -lm */
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static _Noreturn void money_fail(const char *kind, const char *message) {
+    fflush(stdout);
+    fprintf(stderr, "Erro %s: %s\n", kind, message);
+    exit(EXIT_FAILURE);
+}
+
+#define MONEY_JUROS 0.05
+
+static void money_print(double value) {
+    if (isnan(value)) {
+        money_fail("inesperado", "cannot convert float NaN to integer");
+    }
+    if (isinf(value)) {
+        money_fail("inesperado", "cannot convert float infinity to integer");
+    }
+    if (value == trunc(value)) {
+        printf("%.0f\n", value == 0.0 ? 0.0 : value);
+    } else {
+        printf("%.2f\n", value);
+    }
+}
+
+/* Python's float modulo: the result takes the sign of the divisor. */
+static double money_mod(double a, double b) {
+    double mod = fmod(a, b);
+    if (mod != 0.0) {
+        if ((b < 0) != (mod < 0)) {
+            mod += b;
+        }
+    } else {
+        mod = copysign(0.0, b);
+    }
+    return mod;
+}
+
+int main(void) {
+    double mv_c0 = 0.0;
+    double mv_v0 = 0.0;
+    bool md_v0 = false;
+    double mv_v1 = 0.0;
+    bool md_v1 = false;
+    double mv_v2 = 0.0;
+    bool md_v2 = false;
+    double mv_v3 = 0.0;
+    bool md_v3 = false;
+    double mv_i0 = 0.0;
+    bool md_i0 = false;
+    double mv_i1 = 0.0;
+    bool md_i1 = false;
+    mv_c0 = 2301.0;
+    mv_v0 = 72.0;
+    md_v0 = true;
+    mv_v1 = 97.0;
+    md_v1 = true;
+    mv_v2 = 8.0;
+    md_v2 = true;
+    mv_v3 = 32.0;
+    md_v3 = true;
+    mv_i0 = 10.0;
+    md_i0 = true;
+    while (mv_i0 > 0.0) {
+        mv_i1 = 10.0;
+        md_i1 = true;
+        while (mv_i1 > 0.0) {
+            mv_c0 += mv_c0 * 0.001;
+            mv_c0 -= 8.0;
+            mv_c0 += mv_c0 * 0.001;
+            mv_c0 += money_mod(((mv_i0 + mv_i0) + mv_c0), 97.0);
+            mv_c0 += mv_c0 * 0.001;
+            mv_i1 = (mv_i1 - 1.0);
+            md_i1 = true;
+        }
+        mv_i0 = (mv_i0 - 1.0);
+        md_i0 = true;
+    }
+    fputs("Saldo final:\n", stdout);
+    money_print(mv_c0);
+    return 0;
+}
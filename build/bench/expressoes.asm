@@ -0,0 +1,794 @@
+# BankVM assembly generated by MoneyLang compiler
+LINE 2
+ACCOUNT_INIT c0
+PUSH_CONST 2301
+STORE c0
+LINE 3
+ACCOUNT_INIT c1
+PUSH_CONST 9425
+STORE c1
+LINE 4
+ACCOUNT_INIT c2
+PUSH_CONST 1133
+STORE c2
+LINE 5
+ACCOUNT_INIT c3
+PUSH_CONST 4279
+STORE c3
+LINE 6
+PUSH_CONST 15
+STORE v0
+LINE 7
+PUSH_CONST 63
+STORE v1
+LINE 8
+PUSH_CONST 97
+STORE v2
+LINE 9
+PUSH_CONST 57
+STORE v3
+LINE 10
+PUSH_CONST 2000
+STORE i0
+LABEL loop_0
+LINE 11
+LOAD i0
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_1
+LINE 12
+PUSH_CONST 0.001
+APPLY_INTEREST c1
+LINE 13
+PUSH_CONST 78
+PUSH_CONST 35
+ADD
+LOAD c2
+SUB
+LOAD c0
+ADD
+PUSH_CONST 88
+ADD
+PUSH_CONST 93
+SUB
+LOAD v3
+ADD
+PUSH_CONST 2
+DIV
+LOAD i0
+SUB
+PUSH_CONST 38
+SUB
+PUSH_CONST 72
+ADD
+LOAD v2
+ADD
+LOAD i0
+ADD
+LOAD i0
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 32
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+LOAD i0
+SUB
+PUSH_CONST 85
+ADD
+LOAD v3
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 6
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD v1
+SUB
+LOAD v1
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 97
+MOD
+DEPOSIT c3
+LINE 14
+LOAD i0
+PUSH_CONST 2
+DIV
+LOAD v3
+SUB
+PUSH_CONST 47
+ADD
+PUSH_CONST 63
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+LOAD i0
+ADD
+LOAD v1
+ADD
+LOAD c2
+SUB
+LOAD c0
+ADD
+PUSH_CONST 2
+ADD
+PUSH_CONST 0.5
+MUL
+LOAD i0
+SUB
+LOAD i0
+SUB
+LOAD v1
+ADD
+PUSH_CONST 0.5
+MUL
+LOAD i0
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+LOAD c2
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD i0
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 3
+SUB
+LOAD c3
+SUB
+PUSH_CONST 1000
+MOD
+STORE v3
+LINE 15
+PUSH_CONST 70
+PUSH_CONST 29
+SUB
+PUSH_CONST 87
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD i0
+ADD
+LOAD c2
+SUB
+LOAD c2
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 73
+SUB
+PUSH_CONST 0.5
+MUL
+LOAD c0
+SUB
+PUSH_CONST 22
+SUB
+PUSH_CONST 26
+ADD
+PUSH_CONST 0.5
+MUL
+LOAD v3
+ADD
+PUSH_CONST 14
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD i0
+ADD
+PUSH_CONST 0.5
+MUL
+LOAD v1
+ADD
+PUSH_CONST 0.5
+MUL
+LOAD i0
+SUB
+LOAD i0
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD c0
+SUB
+LOAD v1
+ADD
+PUSH_CONST 1000
+MOD
+STORE v3
+LINE 16
+LOAD i0
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD i0
+ADD
+PUSH_CONST 2
+DIV
+LOAD c2
+SUB
+PUSH_CONST 10
+ADD
+PUSH_CONST 2
+DIV
+LOAD v2
+SUB
+PUSH_CONST 10
+ADD
+LOAD c2
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 36
+ADD
+LOAD c2
+ADD
+LOAD c0
+ADD
+PUSH_CONST 2
+DIV
+LOAD c1
+ADD
+PUSH_CONST 21
+SUB
+PUSH_CONST 22
+ADD
+LOAD v0
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+LOAD v2
+ADD
+LOAD c0
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 1000
+MOD
+STORE v2
+LINE 17
+PUSH_CONST 6
+TRANSFER c3 c1
+LINE 18
+PUSH_CONST 15
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 85
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD v2
+SUB
+LOAD v2
+SUB
+LOAD i0
+ADD
+PUSH_CONST 2
+DIV
+LOAD i0
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+LOAD i0
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD i0
+SUB
+LOAD v1
+ADD
+LOAD v3
+ADD
+LOAD i0
+ADD
+LOAD c0
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+LOAD c2
+SUB
+LOAD v1
+ADD
+LOAD v2
+SUB
+PUSH_CONST 0.5
+MUL
+LOAD i0
+ADD
+LOAD v0
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 97
+MOD
+DEPOSIT c2
+LINE 19
+LOAD i0
+LOAD c1
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 56
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 44
+ADD
+LOAD i0
+SUB
+PUSH_CONST 74
+ADD
+LOAD c2
+ADD
+LOAD v1
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+LOAD c1
+SUB
+PUSH_CONST 2
+DIV
+LOAD v2
+ADD
+PUSH_CONST 2
+DIV
+LOAD v2
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 44
+SUB
+PUSH_CONST 0.5
+MUL
+LOAD c0
+SUB
+PUSH_CONST 0.5
+MUL
+LOAD v2
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 1000
+MOD
+STORE v1
+LINE 20
+LOAD c3
+LOAD v2
+SUB
+PUSH_CONST 2
+DIV
+LOAD c3
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD c0
+SUB
+PUSH_CONST 0.5
+MUL
+LOAD i0
+ADD
+LOAD c3
+SUB
+PUSH_CONST 56
+SUB
+PUSH_CONST 2
+DIV
+LOAD i0
+SUB
+PUSH_CONST 28
+SUB
+PUSH_CONST 77
+ADD
+PUSH_CONST 2
+DIV
+LOAD i0
+ADD
+PUSH_CONST 96
+SUB
+LOAD v3
+ADD
+LOAD c1
+ADD
+PUSH_CONST 0.5
+MUL
+LOAD v2
+SUB
+LOAD v2
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD i0
+SUB
+PUSH_CONST 2
+DIV
+LOAD v3
+ADD
+LOAD i0
+SUB
+PUSH_CONST 1000
+MOD
+STORE v0
+LINE 21
+LOAD c2
+LOAD c2
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD c3
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 49
+ADD
+LOAD c2
+SUB
+PUSH_CONST 77
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 80
+SUB
+LOAD i0
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 96
+ADD
+LOAD i0
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 35
+SUB
+LOAD c0
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 97
+MOD
+DEPOSIT c0
+LINE 22
+PUSH_CONST 0.001
+APPLY_INTEREST c2
+LINE 23
+PUSH_CONST 8
+TRANSFER c3 c0
+LINE 24
+PUSH_CONST 7
+TRANSFER c0 c3
+LINE 25
+LOAD c1
+LOAD c3
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD v1
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD c2
+ADD
+PUSH_CONST 2
+DIV
+LOAD v2
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 72
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 34
+SUB
+PUSH_CONST 0.5
+MUL
+LOAD i0
+SUB
+PUSH_CONST 41
+ADD
+PUSH_CONST 2
+DIV
+LOAD i0
+SUB
+LOAD v3
+ADD
+LOAD i0
+SUB
+LOAD v1
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD c1
+SUB
+PUSH_CONST 0.5
+MUL
+LOAD c1
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 97
+MOD
+DEPOSIT c3
+LINE 26
+LOAD c0
+LOAD v0
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD v0
+ADD
+PUSH_CONST 30
+SUB
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+LOAD v1
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 92
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+LOAD v0
+ADD
+LOAD c0
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 21
+SUB
+LOAD c0
+SUB
+PUSH_CONST 2
+DIV
+LOAD c3
+SUB
+PUSH_CONST 0.5
+MUL
+LOAD c3
+SUB
+PUSH_CONST 97
+MOD
+DEPOSIT c1
+LINE 27
+PUSH_CONST 9
+TRANSFER c0 c1
+LINE 28
+PUSH_CONST 5
+WITHDRAW c0
+LINE 29
+PUSH_CONST 0.001
+APPLY_INTEREST c0
+LINE 30
+PUSH_CONST 0.001
+APPLY_INTEREST c1
+LINE 31
+PUSH_CONST 43
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD v0
+SUB
+LOAD i0
+SUB
+LOAD i0
+ADD
+PUSH_CONST 85
+SUB
+LOAD i0
+ADD
+PUSH_CONST 0.5
+MUL
+LOAD c1
+SUB
+LOAD v3
+ADD
+LOAD c0
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+LOAD i0
+ADD
+LOAD c3
+SUB
+PUSH_CONST 98
+SUB
+PUSH_CONST 2
+DIV
+LOAD i0
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 0.5
+MUL
+LOAD i0
+ADD
+PUSH_CONST 2
+DIV
+LOAD i0
+ADD
+LOAD i0
+SUB
+LOAD i0
+ADD
+PUSH_CONST 2
+DIV
+LOAD v2
+SUB
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 1000
+MOD
+STORE v3
+LINE 32
+LOAD i0
+PUSH_CONST 1
+SUB
+STORE i0
+LINE 11
+JMP loop_0
+LABEL endloop_1
+LINE 33
+PRINT_STR_LITERAL "Saldo final:"
+LOAD c0
+PRINT
+LINE 0
+HALT
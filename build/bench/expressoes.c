@@ -0,0 +1,116 @@
+/* Generated by moneyc --emit=c; build with: cc -O2 programa.c -lm */
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static _Noreturn void money_fail(const char *kind, const char *message) {
+    fflush(stdout);
+    fprintf(stderr, "Erro %s: %s\n", kind, message);
+    exit(EXIT_FAILURE);
+}
+
+#define MONEY_JUROS 0.05
+
+static void money_print(double value) {
+    if (isnan(value)) {
+        money_fail("inesperado", "cannot convert float NaN to integer");
+    }
+    if (isinf(value)) {
+        money_fail("inesperado", "cannot convert float infinity to integer");
+    }
+    if (value == trunc(value)) {
+        printf("%.0f\n", value == 0.0 ? 0.0 : value);
+    } else {
+        printf("%.2f\n", value);
+    }
+}
+
+/* Python's float modulo: the result takes the sign of the divisor. */
+static double money_mod(double a, double b) {
+    double mod = fmod(a, b);
+    if (mod != 0.0) {
+        if ((b < 0) != (mod < 0)) {
+            mod += b;
+        }
+    } else {
+        mod = copysign(0.0, b);
+    }
+    return mod;
+}
+
+int main(void) {
+    double mv_c0 = 0.0;
+    double mv_c1 = 0.0;
+    double mv_c2 = 0.0;
+    double mv_c3 = 0.0;
+    double mv_v0 = 0.0;
+    bool md_v0 = false;
+    double mv_v1 = 0.0;
+    bool md_v1 = false;
+    double mv_v2 = 0.0;
+    bool md_v2 = false;
+    double mv_v3 = 0.0;
+    bool md_v3 = false;
+    double mv_i0 = 0.0;
+    bool md_i0 = false;
+    mv_c0 = 2301.0;
+    mv_c1 = 9425.0;
+    mv_c2 = 1133.0;
+    mv_c3 = 4279.0;
+    mv_v0 = 15.0;
+    md_v0 = true;
+    mv_v1 = 63.0;
+    md_v1 = true;
+    mv_v2 = 97.0;
+    md_v2 = true;
+    mv_v3 = 57.0;
+    md_v3 = true;
+    mv_i0 = 2000.0;
+    md_i0 = true;
+    while (mv_i0 > 0.0) {
+        mv_c1 += mv_c1 * 0.001;
+        mv_c3 += money_mod(((((((((((((((((((((((((((((((78.0 + 35.0) - mv_c2) + mv_c0) + 88.0) - 93.0) + mv_v3) / 2.0) - mv_i0) - 38.0) + 72.0) + mv_v2) + mv_i0) - mv_i0) / 2.0) / 2.0) + 32.0) / 2.0) / 2.0) - mv_i0) + 85.0) + mv_v3) * 0.5) / 2.0) + 6.0) * 0.5) / 2.0) - mv_v1) + mv_v1) / 2.0) * 0.5), 97.0);
+        mv_v3 = money_mod(((((((((((((((((((((((((((((((mv_i0 / 2.0) - mv_v3) + 47.0) - 63.0) * 0.5) / 2.0) * 0.5) + mv_i0) + mv_v1) - mv_c2) + mv_c0) + 2.0) * 0.5) - mv_i0) - mv_i0) + mv_v1) * 0.5) - mv_i0) / 2.0) * 0.5) / 2.0) / 2.0) + mv_c2) / 2.0) * 0.5) / 2.0) - mv_i0) * 0.5) - 3.0) - mv_c3), 1000.0);
+        md_v3 = true;
+        mv_v3 = money_mod(((((((((((((((((((((((((((((((70.0 - 29.0) + 87.0) * 0.5) / 2.0) + mv_i0) - mv_c2) + mv_c2) * 0.5) - 73.0) * 0.5) - mv_c0) - 22.0) + 26.0) * 0.5) + mv_v3) - 14.0) / 2.0) * 0.5) / 2.0) + mv_i0) * 0.5) + mv_v1) * 0.5) - mv_i0) - mv_i0) / 2.0) * 0.5) / 2.0) - mv_c0) + mv_v1), 1000.0);
+        md_v3 = true;
+        mv_v2 = money_mod(((((((((((((((((((((((((((((((mv_i0 * 0.5) * 0.5) * 0.5) + mv_i0) / 2.0) - mv_c2) + 10.0) / 2.0) - mv_v2) + 10.0) - mv_c2) * 0.5) * 0.5) + 36.0) + mv_c2) + mv_c0) / 2.0) + mv_c1) - 21.0) + 22.0) - mv_v0) / 2.0) / 2.0) * 0.5) * 0.5) / 2.0) * 0.5) + mv_v2) + mv_c0) * 0.5), 1000.0);
+        md_v2 = true;
+        const double e0 = 6.0;
+        mv_c3 -= e0;
+        mv_c1 += e0;
+        mv_c2 += money_mod(((((((((((((((((((((((((((((((15.0 * 0.5) - 85.0) * 0.5) * 0.5) - mv_v2) - mv_v2) + mv_i0) / 2.0) + mv_i0) / 2.0) * 0.5) + mv_i0) * 0.5) * 0.5) - mv_i0) + mv_v1) + mv_v3) + mv_i0) + mv_c0) * 0.5) * 0.5) / 2.0) / 2.0) - mv_c2) + mv_v1) - mv_v2) * 0.5) + mv_i0) - mv_v0) * 0.5), 97.0);
+        mv_v1 = money_mod(((((((((((((((((((((((((((((((mv_i0 - mv_c1) * 0.5) + 56.0) * 0.5) / 2.0) / 2.0) + 44.0) - mv_i0) + 74.0) + mv_c2) - mv_v1) * 0.5) * 0.5) / 2.0) / 2.0) - mv_c1) / 2.0) + mv_v2) / 2.0) - mv_v2) / 2.0) / 2.0) - 44.0) * 0.5) - mv_c0) * 0.5) - mv_v2) * 0.5) * 0.5) * 0.5), 1000.0);
+        md_v1 = true;
+        mv_v0 = money_mod(((((((((((((((((((((((((((((((mv_c3 - mv_v2) / 2.0) - mv_c3) / 2.0) * 0.5) / 2.0) - mv_c0) * 0.5) + mv_i0) - mv_c3) - 56.0) / 2.0) - mv_i0) - 28.0) + 77.0) / 2.0) + mv_i0) - 96.0) + mv_v3) + mv_c1) * 0.5) - mv_v2) - mv_v2) * 0.5) * 0.5) / 2.0) - mv_i0) / 2.0) + mv_v3) - mv_i0), 1000.0);
+        md_v0 = true;
+        mv_c0 += money_mod(((((((((((((((((((((((((((((((mv_c2 - mv_c2) * 0.5) / 2.0) * 0.5) * 0.5) + mv_c3) / 2.0) * 0.5) * 0.5) / 2.0) * 0.5) / 2.0) + 49.0) - mv_c2) - 77.0) / 2.0) * 0.5) - 80.0) - mv_i0) / 2.0) / 2.0) / 2.0) * 0.5) + 96.0) - mv_i0) / 2.0) - 35.0) - mv_c0) * 0.5) * 0.5), 97.0);
+        mv_c2 += mv_c2 * 0.001;
+        const double e1 = 8.0;
+        mv_c3 -= e1;
+        mv_c0 += e1;
+        const double e2 = 7.0;
+        mv_c0 -= e2;
+        mv_c3 += e2;
+        mv_c3 += money_mod(((((((((((((((((((((((((((((((mv_c1 - mv_c3) * 0.5) * 0.5) - mv_v1) * 0.5) * 0.5) + mv_c2) / 2.0) + mv_v2) * 0.5) * 0.5) - 72.0) / 2.0) - 34.0) * 0.5) - mv_i0) + 41.0) / 2.0) - mv_i0) + mv_v3) - mv_i0) - mv_v1) / 2.0) * 0.5) * 0.5) / 2.0) - mv_c1) * 0.5) + mv_c1) / 2.0), 97.0);
+        mv_c1 += money_mod(((((((((((((((((((((((((((((((mv_c0 + mv_v0) / 2.0) / 2.0) * 0.5) * 0.5) + mv_v0) - 30.0) / 2.0) / 2.0) / 2.0) - mv_v1) * 0.5) / 2.0) / 2.0) - 92.0) * 0.5) * 0.5) / 2.0) + mv_v0) + mv_c0) / 2.0) * 0.5) / 2.0) * 0.5) - 21.0) - mv_c0) / 2.0) - mv_c3) * 0.5) - mv_c3), 97.0);
+        const double e3 = 9.0;
+        mv_c0 -= e3;
+        mv_c1 += e3;
+        mv_c0 -= 5.0;
+        mv_c0 += mv_c0 * 0.001;
+        mv_c1 += mv_c1 * 0.001;
+        mv_v3 = money_mod(((((((((((((((((((((((((((((((43.0 * 0.5) * 0.5) - mv_v0) - mv_i0) + mv_i0) - 85.0) + mv_i0) * 0.5) - mv_c1) + mv_v3) + mv_c0) / 2.0) * 0.5) + mv_i0) - mv_c3) - 98.0) / 2.0) + mv_i0) * 0.5) * 0.5) + mv_i0) / 2.0) + mv_i0) - mv_i0) + mv_i0) / 2.0) - mv_v2) * 0.5) / 2.0) / 2.0), 1000.0);
+        md_v3 = true;
+        mv_i0 = (mv_i0 - 1.0);
+        md_i0 = true;
+    }
+    fputs("Saldo final:\n", stdout);
+    money_print(mv_c0);
+    return 0;
+}
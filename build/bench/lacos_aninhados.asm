@@ -0,0 +1,180 @@
+# BankVM assembly generated by MoneyLang compiler
+LINE 2
+ACCOUNT_INIT c0
+PUSH_CONST 2301
+STORE c0
+LINE 3
+ACCOUNT_INIT c1
+PUSH_CONST 9425
+STORE c1
+LINE 4
+ACCOUNT_INIT c2
+PUSH_CONST 1133
+STORE c2
+LINE 5
+ACCOUNT_INIT c3
+PUSH_CONST 4279
+STORE c3
+LINE 6
+ACCOUNT_INIT c4
+PUSH_CONST 2031
+STORE c4
+LINE 7
+ACCOUNT_INIT c5
+PUSH_CONST 8217
+STORE c5
+LINE 8
+ACCOUNT_INIT c6
+PUSH_CONST 7464
+STORE c6
+LINE 9
+ACCOUNT_INIT c7
+PUSH_CONST 7837
+STORE c7
+LINE 10
+PUSH_CONST 83
+STORE v0
+LINE 11
+PUSH_CONST 48
+STORE v1
+LINE 12
+PUSH_CONST 26
+STORE v2
+LINE 13
+PUSH_CONST 12
+STORE v3
+LINE 14
+PUSH_CONST 8
+STORE i0
+LABEL loop_0
+LINE 15
+LOAD i0
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_1
+LINE 16
+PUSH_CONST 8
+STORE i1
+LABEL loop_2
+LINE 17
+LOAD i1
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_3
+LINE 18
+PUSH_CONST 8
+STORE i2
+LABEL loop_4
+LINE 19
+LOAD i2
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_5
+LINE 20
+PUSH_CONST 8
+STORE i3
+LABEL loop_6
+LINE 21
+LOAD i3
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_7
+LINE 22
+PUSH_CONST 8
+STORE i4
+LABEL loop_8
+LINE 23
+LOAD i4
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_9
+LINE 24
+PUSH_CONST 8
+STORE i5
+LABEL loop_10
+LINE 25
+LOAD i5
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_11
+LINE 26
+PUSH_CONST 0.001
+APPLY_INTEREST c6
+LINE 27
+LOAD i5
+LOAD c5
+SUB
+LOAD c0
+ADD
+PUSH_CONST 97
+MOD
+DEPOSIT c7
+LINE 28
+LOAD v3
+LOAD v3
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 97
+MOD
+DEPOSIT c6
+LINE 29
+PUSH_CONST 4
+TRANSFER c3 c6
+LINE 30
+PUSH_CONST 9
+TRANSFER c0 c4
+LINE 31
+LOAD i5
+PUSH_CONST 1
+SUB
+STORE i5
+LINE 25
+JMP loop_10
+LABEL endloop_11
+LINE 32
+LOAD i4
+PUSH_CONST 1
+SUB
+STORE i4
+LINE 23
+JMP loop_8
+LABEL endloop_9
+LINE 33
+LOAD i3
+PUSH_CONST 1
+SUB
+STORE i3
+LINE 21
+JMP loop_6
+LABEL endloop_7
+LINE 34
+LOAD i2
+PUSH_CONST 1
+SUB
+STORE i2
+LINE 19
+JMP loop_4
+LABEL endloop_5
+LINE 35
+LOAD i1
+PUSH_CONST 1
+SUB
+STORE i1
+LINE 17
+JMP loop_2
+LABEL endloop_3
+LINE 36
+LOAD i0
+PUSH_CONST 1
+SUB
+STORE i0
+LINE 15
+JMP loop_0
+LABEL endloop_1
+LINE 37
+PRINT_STR_LITERAL "Saldo final:"
+LOAD c0
+PRINT
+LINE 0
+HALT
@@ -0,0 +1,139 @@
+/* Generated by moneyc --emit=c; build with: cc -O2 programa.c -lm */
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static _Noreturn void money_fail(const char *kind, const char *message) {
+    fflush(stdout);
+    fprintf(stderr, "Erro %s: %s\n", kind, message);
+    exit(EXIT_FAILURE);
+}
+
+#define MONEY_JUROS 0.05
+
+static void money_print(double value) {
+    if (isnan(value)) {
+        money_fail("inesperado", "cannot convert float NaN to integer");
+    }
+    if (isinf(value)) {
+        money_fail("inesperado", "cannot convert float infinity to integer");
+    }
+    if (value == trunc(value)) {
+        printf("%.0f\n", value == 0.0 ? 0.0 : value);
+    } else {
+        printf("%.2f\n", value);
+    }
+}
+
+/* Python's float modulo: the result takes the sign of the divisor. */
+static double money_mod(double a, double b) {
+    double mod = fmod(a, b);
+    if (mod != 0.0) {
+        if ((b < 0) != (mod < 0)) {
+            mod += b;
+        }
+    } else {
+        mod = copysign(0.0, b);
+    }
+    return mod;
+}
+
+int main(void) {
+    double mv_c0 = 0.0;
+    double mv_c1 = 0.0;
+    double mv_c2 = 0.0;
+    double mv_c3 = 0.0;
+    double mv_c4 = 0.0;
+    double mv_c5 = 0.0;
+    double mv_c6 = 0.0;
+    double mv_c7 = 0.0;
+    double mv_v0 = 0.0;
+    bool md_v0 = false;
+    double mv_v1 = 0.0;
+    bool md_v1 = false;
+    double mv_v2 = 0.0;
+    bool md_v2 = false;
+    double mv_v3 = 0.0;
+    bool md_v3 = false;
+    double mv_i0 = 0.0;
+    bool md_i0 = false;
+    double mv_i1 = 0.0;
+    bool md_i1 = false;
+    double mv_i2 = 0.0;
+    bool md_i2 = false;
+    double mv_i3 = 0.0;
+    bool md_i3 = false;
+    double mv_i4 = 0.0;
+    bool md_i4 = false;
+    double mv_i5 = 0.0;
+    bool md_i5 = false;
+    mv_c0 = 2301.0;
+    mv_c1 = 9425.0;
+    mv_c2 = 1133.0;
+    mv_c3 = 4279.0;
+    mv_c4 = 2031.0;
+    mv_c5 = 8217.0;
+    mv_c6 = 7464.0;
+    mv_c7 = 7837.0;
+    mv_v0 = 83.0;
+    md_v0 = true;
+    mv_v1 = 48.0;
+    md_v1 = true;
+    mv_v2 = 26.0;
+    md_v2 = true;
+    mv_v3 = 12.0;
+    md_v3 = true;
+    mv_i0 = 8.0;
+    md_i0 = true;
+    while (mv_i0 > 0.0) {
+        mv_i1 = 8.0;
+        md_i1 = true;
+        while (mv_i1 > 0.0) {
+            mv_i2 = 8.0;
+            md_i2 = true;
+            while (mv_i2 > 0.0) {
+                mv_i3 = 8.0;
+                md_i3 = true;
+                while (mv_i3 > 0.0) {
+                    mv_i4 = 8.0;
+                    md_i4 = true;
+                    while (mv_i4 > 0.0) {
+                        mv_i5 = 8.0;
+                        md_i5 = true;
+                        while (mv_i5 > 0.0) {
+                            mv_c6 += mv_c6 * 0.001;
+                            mv_c7 += money_mod(((mv_i5 - mv_c5) + mv_c0), 97.0);
+                            mv_c6 += money_mod(((mv_v3 + mv_v3) / 2.0), 97.0);
+                            const double e0 = 4.0;
+                            mv_c3 -= e0;
+                            mv_c6 += e0;
+                            const double e1 = 9.0;
+                            mv_c0 -= e1;
+                            mv_c4 += e1;
+                            mv_i5 = (mv_i5 - 1.0);
+                            md_i5 = true;
+                        }
+                        mv_i4 = (mv_i4 - 1.0);
+                        md_i4 = true;
+                    }
+                    mv_i3 = (mv_i3 - 1.0);
+                    md_i3 = true;
+                }
+                mv_i2 = (mv_i2 - 1.0);
+                md_i2 = true;
+            }
+            mv_i1 = (mv_i1 - 1.0);
+            md_i1 = true;
+        }
+        mv_i0 = (mv_i0 - 1.0);
+        md_i0 = true;
+    }
+    fputs("Saldo final:\n", stdout);
+    money_print(mv_c0);
+    return 0;
+}
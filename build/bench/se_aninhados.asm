@@ -0,0 +1,10123 @@
+# BankVM assembly generated by MoneyLang compiler
+LINE 2
+ACCOUNT_INIT c0
+PUSH_CONST 2301
+STORE c0
+LINE 3
+ACCOUNT_INIT c1
+PUSH_CONST 9425
+STORE c1
+LINE 4
+ACCOUNT_INIT c2
+PUSH_CONST 1133
+STORE c2
+LINE 5
+ACCOUNT_INIT c3
+PUSH_CONST 4279
+STORE c3
+LINE 6
+ACCOUNT_INIT c4
+PUSH_CONST 2031
+STORE c4
+LINE 7
+ACCOUNT_INIT c5
+PUSH_CONST 8217
+STORE c5
+LINE 8
+ACCOUNT_INIT c6
+PUSH_CONST 7464
+STORE c6
+LINE 9
+ACCOUNT_INIT c7
+PUSH_CONST 7837
+STORE c7
+LINE 10
+PUSH_CONST 83
+STORE v0
+LINE 11
+PUSH_CONST 48
+STORE v1
+LINE 12
+PUSH_CONST 26
+STORE v2
+LINE 13
+PUSH_CONST 12
+STORE v3
+LINE 14
+PUSH_CONST 0.001
+APPLY_INTEREST c6
+LINE 15
+PUSH_CONST 93
+LOAD c5
+SUB
+LOAD c0
+ADD
+PUSH_CONST 97
+MOD
+DEPOSIT c7
+LINE 16
+LOAD v3
+LOAD v3
+ADD
+PUSH_CONST 2
+DIV
+PUSH_CONST 97
+MOD
+DEPOSIT c6
+LINE 17
+PUSH_CONST 4
+TRANSFER c3 c6
+LINE 18
+PUSH_CONST 9
+TRANSFER c0 c4
+LINE 19
+PUSH_CONST 16
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 97
+MOD
+DEPOSIT c2
+LINE 20
+PUSH_CONST 76
+PUSH_CONST 2
+DIV
+PUSH_CONST 2
+DIV
+PUSH_CONST 1000
+MOD
+STORE v2
+LINE 21
+LOAD v3
+PUSH_CONST 2
+DIV
+PUSH_CONST 71
+SUB
+PUSH_CONST 97
+MOD
+DEPOSIT c7
+LINE 22
+PUSH_CONST 85
+LOAD v3
+ADD
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 1000
+MOD
+STORE v0
+LINE 23
+LOAD c4
+PUSH_CONST 2
+DIV
+LOAD v1
+SUB
+PUSH_CONST 97
+MOD
+DEPOSIT c7
+LINE 24
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_0
+LINE 25
+PUSH_CONST 1
+DEPOSIT c3
+LINE 26
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_1
+LINE 27
+PUSH_CONST 1
+DEPOSIT c6
+LINE 28
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_2
+LINE 29
+PUSH_CONST 1
+DEPOSIT c5
+LINE 30
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_3
+LINE 31
+PUSH_CONST 1
+DEPOSIT c4
+LINE 32
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_4
+LINE 33
+PUSH_CONST 1
+DEPOSIT c6
+LINE 34
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_5
+LINE 35
+PUSH_CONST 1
+DEPOSIT c3
+LINE 36
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_6
+LINE 37
+PUSH_CONST 1
+DEPOSIT c0
+LINE 38
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_7
+LINE 39
+PUSH_CONST 1
+DEPOSIT c5
+LINE 40
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_8
+LINE 41
+PUSH_CONST 1
+DEPOSIT c6
+LINE 42
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_9
+LINE 43
+PUSH_CONST 1
+DEPOSIT c5
+LINE 44
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_10
+LINE 45
+PUSH_CONST 1
+DEPOSIT c5
+LINE 46
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_11
+LINE 47
+PUSH_CONST 1
+DEPOSIT c5
+LINE 48
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_12
+LINE 49
+PUSH_CONST 1
+DEPOSIT c0
+LINE 50
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_13
+LINE 51
+PUSH_CONST 1
+DEPOSIT c2
+LINE 52
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_14
+LINE 53
+PUSH_CONST 1
+DEPOSIT c1
+LINE 54
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_15
+LINE 55
+PUSH_CONST 1
+DEPOSIT c0
+LINE 56
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_16
+LINE 57
+PUSH_CONST 1
+DEPOSIT c1
+LINE 58
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_17
+LINE 59
+PUSH_CONST 1
+DEPOSIT c7
+LINE 60
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_18
+LINE 61
+PUSH_CONST 1
+DEPOSIT c4
+LINE 62
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_19
+LINE 63
+PUSH_CONST 1
+DEPOSIT c4
+LINE 64
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_20
+LINE 65
+PUSH_CONST 1
+DEPOSIT c2
+LINE 66
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_21
+LINE 67
+PUSH_CONST 1
+DEPOSIT c4
+LINE 68
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_22
+LINE 69
+PUSH_CONST 1
+DEPOSIT c2
+LINE 70
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_23
+LINE 71
+PUSH_CONST 1
+DEPOSIT c4
+LINE 72
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_24
+LINE 73
+PUSH_CONST 1
+DEPOSIT c4
+LINE 74
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_25
+LINE 75
+PUSH_CONST 1
+DEPOSIT c7
+LINE 76
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_26
+LINE 77
+PUSH_CONST 1
+DEPOSIT c7
+LINE 78
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_27
+LINE 79
+PUSH_CONST 1
+DEPOSIT c1
+LINE 80
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_28
+LINE 81
+PUSH_CONST 1
+DEPOSIT c4
+LINE 82
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_29
+LINE 83
+PUSH_CONST 1
+DEPOSIT c5
+LINE 84
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_30
+LINE 85
+PUSH_CONST 1
+DEPOSIT c3
+LINE 86
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_31
+LINE 87
+PUSH_CONST 1
+DEPOSIT c1
+LINE 88
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_32
+LINE 89
+PUSH_CONST 1
+DEPOSIT c3
+LINE 90
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_33
+LINE 91
+PUSH_CONST 1
+DEPOSIT c0
+LINE 92
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_34
+LINE 93
+PUSH_CONST 1
+DEPOSIT c0
+LINE 94
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_35
+LINE 95
+PUSH_CONST 1
+DEPOSIT c2
+LINE 96
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_36
+LINE 97
+PUSH_CONST 1
+DEPOSIT c2
+LINE 98
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_37
+LINE 99
+PUSH_CONST 1
+DEPOSIT c6
+LINE 100
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_38
+LINE 101
+PUSH_CONST 1
+DEPOSIT c7
+LINE 102
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_39
+LINE 103
+PUSH_CONST 1
+DEPOSIT c0
+LINE 104
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_40
+LINE 105
+PUSH_CONST 1
+DEPOSIT c5
+LINE 106
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_41
+LINE 107
+PUSH_CONST 1
+DEPOSIT c0
+LINE 108
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_42
+LINE 109
+PUSH_CONST 1
+DEPOSIT c2
+LINE 110
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_43
+LINE 111
+PUSH_CONST 1
+DEPOSIT c0
+LINE 112
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_44
+LINE 113
+PUSH_CONST 1
+DEPOSIT c1
+LINE 114
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_45
+LINE 115
+PUSH_CONST 1
+DEPOSIT c4
+LINE 116
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_46
+LINE 117
+PUSH_CONST 1
+DEPOSIT c2
+LINE 118
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_47
+LINE 119
+PUSH_CONST 1
+DEPOSIT c4
+LINE 120
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_48
+LINE 121
+PUSH_CONST 1
+DEPOSIT c0
+LINE 122
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_49
+LINE 123
+PUSH_CONST 1
+DEPOSIT c3
+LINE 124
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_50
+LINE 125
+PUSH_CONST 1
+DEPOSIT c2
+LINE 126
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_51
+LINE 127
+PUSH_CONST 1
+DEPOSIT c6
+LINE 128
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_52
+LINE 129
+PUSH_CONST 1
+DEPOSIT c5
+LINE 130
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_53
+LINE 131
+PUSH_CONST 1
+DEPOSIT c3
+LINE 132
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_54
+LINE 133
+PUSH_CONST 1
+DEPOSIT c3
+LINE 134
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_55
+LINE 135
+PUSH_CONST 1
+DEPOSIT c1
+LINE 136
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_56
+LINE 137
+PUSH_CONST 1
+DEPOSIT c4
+LINE 138
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_57
+LINE 139
+PUSH_CONST 1
+DEPOSIT c0
+LINE 140
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_58
+LINE 141
+PUSH_CONST 1
+DEPOSIT c6
+LINE 142
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_59
+LINE 143
+PUSH_CONST 1
+DEPOSIT c0
+LINE 144
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_60
+LINE 145
+PUSH_CONST 1
+DEPOSIT c3
+LINE 146
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_61
+LINE 147
+PUSH_CONST 1
+DEPOSIT c2
+LINE 148
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_62
+LINE 149
+PUSH_CONST 1
+DEPOSIT c6
+LINE 150
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_63
+LINE 151
+PUSH_CONST 1
+DEPOSIT c4
+LINE 152
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_64
+LINE 153
+PUSH_CONST 1
+DEPOSIT c6
+LINE 154
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_65
+LINE 155
+PUSH_CONST 1
+DEPOSIT c7
+LINE 156
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_66
+LINE 157
+PUSH_CONST 1
+DEPOSIT c1
+LINE 158
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_67
+LINE 159
+PUSH_CONST 1
+DEPOSIT c1
+LINE 160
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_68
+LINE 161
+PUSH_CONST 1
+DEPOSIT c2
+LINE 162
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_69
+LINE 163
+PUSH_CONST 1
+DEPOSIT c3
+LINE 164
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_70
+LINE 165
+PUSH_CONST 1
+DEPOSIT c5
+LINE 166
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_71
+LINE 167
+PUSH_CONST 1
+DEPOSIT c5
+LINE 168
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_72
+LINE 169
+PUSH_CONST 1
+DEPOSIT c5
+LINE 170
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_73
+LINE 171
+PUSH_CONST 1
+DEPOSIT c4
+LINE 172
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_74
+LINE 173
+PUSH_CONST 1
+DEPOSIT c7
+LINE 174
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_75
+LINE 175
+PUSH_CONST 1
+DEPOSIT c1
+LINE 176
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_76
+LINE 177
+PUSH_CONST 1
+DEPOSIT c0
+LINE 178
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_77
+LINE 179
+PUSH_CONST 1
+DEPOSIT c1
+LINE 180
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_78
+LINE 181
+PUSH_CONST 1
+DEPOSIT c2
+LINE 182
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_79
+LINE 183
+PUSH_CONST 1
+DEPOSIT c5
+LINE 184
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_80
+LINE 185
+PUSH_CONST 1
+DEPOSIT c6
+LINE 186
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_81
+LINE 187
+PUSH_CONST 1
+DEPOSIT c3
+LINE 188
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_82
+LINE 189
+PUSH_CONST 1
+DEPOSIT c4
+LINE 190
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_83
+LINE 191
+PUSH_CONST 1
+DEPOSIT c4
+LINE 192
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_84
+LINE 193
+PUSH_CONST 1
+DEPOSIT c7
+LINE 194
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_85
+LINE 195
+PUSH_CONST 1
+DEPOSIT c1
+LINE 196
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_86
+LINE 197
+PUSH_CONST 1
+DEPOSIT c4
+LINE 198
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_87
+LINE 199
+PUSH_CONST 1
+DEPOSIT c0
+LINE 200
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_88
+LINE 201
+PUSH_CONST 1
+DEPOSIT c6
+LINE 202
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_89
+LINE 203
+PUSH_CONST 1
+DEPOSIT c0
+LINE 204
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_90
+LINE 205
+PUSH_CONST 1
+DEPOSIT c3
+LINE 206
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_91
+LINE 207
+PUSH_CONST 1
+DEPOSIT c2
+LINE 208
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_92
+LINE 209
+PUSH_CONST 1
+DEPOSIT c7
+LINE 210
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_93
+LINE 211
+PUSH_CONST 1
+DEPOSIT c3
+LINE 212
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_94
+LINE 213
+PUSH_CONST 1
+DEPOSIT c1
+LINE 214
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_95
+LINE 215
+PUSH_CONST 1
+DEPOSIT c6
+LINE 216
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_96
+LINE 217
+PUSH_CONST 1
+DEPOSIT c4
+LINE 218
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_97
+LINE 219
+PUSH_CONST 1
+DEPOSIT c5
+LINE 220
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_98
+LINE 221
+PUSH_CONST 1
+DEPOSIT c3
+LINE 222
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_99
+LINE 223
+PUSH_CONST 1
+DEPOSIT c0
+LINE 224
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_100
+LINE 225
+PUSH_CONST 1
+DEPOSIT c0
+LINE 226
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_101
+LINE 227
+PUSH_CONST 1
+DEPOSIT c5
+LINE 228
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_102
+LINE 229
+PUSH_CONST 1
+DEPOSIT c6
+LINE 230
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_103
+LINE 231
+PUSH_CONST 1
+DEPOSIT c6
+LINE 232
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_104
+LINE 233
+PUSH_CONST 1
+DEPOSIT c1
+LINE 234
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_105
+LINE 235
+PUSH_CONST 1
+DEPOSIT c7
+LINE 236
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_106
+LINE 237
+PUSH_CONST 1
+DEPOSIT c4
+LINE 238
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_107
+LINE 239
+PUSH_CONST 1
+DEPOSIT c7
+LINE 240
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_108
+LINE 241
+PUSH_CONST 1
+DEPOSIT c4
+LINE 242
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_109
+LINE 243
+PUSH_CONST 1
+DEPOSIT c3
+LINE 244
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_110
+LINE 245
+PUSH_CONST 1
+DEPOSIT c3
+LINE 246
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_111
+LINE 247
+PUSH_CONST 1
+DEPOSIT c5
+LINE 248
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_112
+LINE 249
+PUSH_CONST 1
+DEPOSIT c4
+LINE 250
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_113
+LINE 251
+PUSH_CONST 1
+DEPOSIT c7
+LINE 252
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_114
+LINE 253
+PUSH_CONST 1
+DEPOSIT c5
+LINE 254
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_115
+LINE 255
+PUSH_CONST 1
+DEPOSIT c6
+LINE 256
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_116
+LINE 257
+PUSH_CONST 1
+DEPOSIT c0
+LINE 258
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_117
+LINE 259
+PUSH_CONST 1
+DEPOSIT c2
+LINE 260
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_118
+LINE 261
+PUSH_CONST 1
+DEPOSIT c4
+LINE 262
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_119
+LINE 263
+PUSH_CONST 1
+DEPOSIT c5
+LINE 264
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_120
+LINE 265
+PUSH_CONST 1
+DEPOSIT c1
+LINE 266
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_121
+LINE 267
+PUSH_CONST 1
+DEPOSIT c3
+LINE 268
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_122
+LINE 269
+PUSH_CONST 1
+DEPOSIT c3
+LINE 270
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_123
+LINE 271
+PUSH_CONST 1
+DEPOSIT c1
+LINE 272
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_124
+LINE 273
+PUSH_CONST 1
+DEPOSIT c1
+LINE 274
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_125
+LINE 275
+PUSH_CONST 1
+DEPOSIT c0
+LINE 276
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_126
+LINE 277
+PUSH_CONST 1
+DEPOSIT c4
+LINE 278
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_127
+LINE 279
+PUSH_CONST 1
+DEPOSIT c7
+LINE 280
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_128
+LINE 281
+PUSH_CONST 1
+DEPOSIT c2
+LINE 282
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_129
+LINE 283
+PUSH_CONST 1
+DEPOSIT c5
+LINE 284
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_130
+LINE 285
+PUSH_CONST 1
+DEPOSIT c2
+LINE 286
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_131
+LINE 287
+PUSH_CONST 1
+DEPOSIT c2
+LINE 288
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_132
+LINE 289
+PUSH_CONST 1
+DEPOSIT c5
+LINE 290
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_133
+LINE 291
+PUSH_CONST 1
+DEPOSIT c1
+LINE 292
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_134
+LINE 293
+PUSH_CONST 1
+DEPOSIT c2
+LINE 294
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_135
+LINE 295
+PUSH_CONST 1
+DEPOSIT c2
+LINE 296
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_136
+LINE 297
+PUSH_CONST 1
+DEPOSIT c5
+LINE 298
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_137
+LINE 299
+PUSH_CONST 1
+DEPOSIT c2
+LINE 300
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_138
+LINE 301
+PUSH_CONST 1
+DEPOSIT c6
+LINE 302
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_139
+LINE 303
+PUSH_CONST 1
+DEPOSIT c0
+LINE 304
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_140
+LINE 305
+PUSH_CONST 1
+DEPOSIT c4
+LINE 306
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_141
+LINE 307
+PUSH_CONST 1
+DEPOSIT c7
+LINE 308
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_142
+LINE 309
+PUSH_CONST 1
+DEPOSIT c4
+LINE 310
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_143
+LINE 311
+PUSH_CONST 1
+DEPOSIT c7
+LINE 312
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_144
+LINE 313
+PUSH_CONST 1
+DEPOSIT c6
+LINE 314
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_145
+LINE 315
+PUSH_CONST 1
+DEPOSIT c2
+LINE 316
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_146
+LINE 317
+PUSH_CONST 1
+DEPOSIT c7
+LINE 318
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_147
+LINE 319
+PUSH_CONST 1
+DEPOSIT c6
+LINE 320
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_148
+LINE 321
+PUSH_CONST 1
+DEPOSIT c0
+LINE 322
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_149
+LINE 323
+PUSH_CONST 1
+DEPOSIT c2
+LINE 324
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_150
+LINE 325
+PUSH_CONST 1
+DEPOSIT c2
+LINE 326
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_151
+LINE 327
+PUSH_CONST 1
+DEPOSIT c4
+LINE 328
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_152
+LINE 329
+PUSH_CONST 1
+DEPOSIT c6
+LINE 330
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_153
+LINE 331
+PUSH_CONST 1
+DEPOSIT c1
+LINE 332
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_154
+LINE 333
+PUSH_CONST 1
+DEPOSIT c7
+LINE 334
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_155
+LINE 335
+PUSH_CONST 1
+DEPOSIT c2
+LINE 336
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_156
+LINE 337
+PUSH_CONST 1
+DEPOSIT c7
+LINE 338
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_157
+LINE 339
+PUSH_CONST 1
+DEPOSIT c3
+LINE 340
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_158
+LINE 341
+PUSH_CONST 1
+DEPOSIT c7
+LINE 342
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_159
+LINE 343
+PUSH_CONST 1
+DEPOSIT c3
+LINE 344
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_160
+LINE 345
+PUSH_CONST 1
+DEPOSIT c5
+LINE 346
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_161
+LINE 347
+PUSH_CONST 1
+DEPOSIT c3
+LINE 348
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_162
+LINE 349
+PUSH_CONST 1
+DEPOSIT c1
+LINE 350
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_163
+LINE 351
+PUSH_CONST 1
+DEPOSIT c2
+LINE 352
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_164
+LINE 353
+PUSH_CONST 1
+DEPOSIT c4
+LINE 354
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_165
+LINE 355
+PUSH_CONST 1
+DEPOSIT c4
+LINE 356
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_166
+LINE 357
+PUSH_CONST 1
+DEPOSIT c2
+LINE 358
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_167
+LINE 359
+PUSH_CONST 1
+DEPOSIT c1
+LINE 360
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_168
+LINE 361
+PUSH_CONST 1
+DEPOSIT c6
+LINE 362
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_169
+LINE 363
+PUSH_CONST 1
+DEPOSIT c2
+LINE 364
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_170
+LINE 365
+PUSH_CONST 1
+DEPOSIT c6
+LINE 366
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_171
+LINE 367
+PUSH_CONST 1
+DEPOSIT c0
+LINE 368
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_172
+LINE 369
+PUSH_CONST 1
+DEPOSIT c6
+LINE 370
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_173
+LINE 371
+PUSH_CONST 1
+DEPOSIT c6
+LINE 372
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_174
+LINE 373
+PUSH_CONST 1
+DEPOSIT c0
+LINE 374
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_175
+LINE 375
+PUSH_CONST 1
+DEPOSIT c4
+LINE 376
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_176
+LINE 377
+PUSH_CONST 1
+DEPOSIT c4
+LINE 378
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_177
+LINE 379
+PUSH_CONST 1
+DEPOSIT c2
+LINE 380
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_178
+LINE 381
+PUSH_CONST 1
+DEPOSIT c7
+LINE 382
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_179
+LINE 383
+PUSH_CONST 1
+DEPOSIT c6
+LINE 384
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_180
+LINE 385
+PUSH_CONST 1
+DEPOSIT c6
+LINE 386
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_181
+LINE 387
+PUSH_CONST 1
+DEPOSIT c5
+LINE 388
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_182
+LINE 389
+PUSH_CONST 1
+DEPOSIT c2
+LINE 390
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_183
+LINE 391
+PUSH_CONST 1
+DEPOSIT c3
+LINE 392
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_184
+LINE 393
+PUSH_CONST 1
+DEPOSIT c6
+LINE 394
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_185
+LINE 395
+PUSH_CONST 1
+DEPOSIT c1
+LINE 396
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_186
+LINE 397
+PUSH_CONST 1
+DEPOSIT c4
+LINE 398
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_187
+LINE 399
+PUSH_CONST 1
+DEPOSIT c6
+LINE 400
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_188
+LINE 401
+PUSH_CONST 1
+DEPOSIT c3
+LINE 402
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_189
+LINE 403
+PUSH_CONST 1
+DEPOSIT c0
+LINE 404
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_190
+LINE 405
+PUSH_CONST 1
+DEPOSIT c3
+LINE 406
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_191
+LINE 407
+PUSH_CONST 1
+DEPOSIT c3
+LINE 408
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_192
+LINE 409
+PUSH_CONST 1
+DEPOSIT c4
+LINE 410
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_193
+LINE 411
+PUSH_CONST 1
+DEPOSIT c3
+LINE 412
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_194
+LINE 413
+PUSH_CONST 1
+DEPOSIT c4
+LINE 414
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_195
+LINE 415
+PUSH_CONST 1
+DEPOSIT c7
+LINE 416
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_196
+LINE 417
+PUSH_CONST 1
+DEPOSIT c5
+LINE 418
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_197
+LINE 419
+PUSH_CONST 1
+DEPOSIT c6
+LINE 420
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_198
+LINE 421
+PUSH_CONST 1
+DEPOSIT c3
+LINE 422
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_199
+LINE 423
+PUSH_CONST 1
+DEPOSIT c3
+LINE 424
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_200
+LINE 425
+PUSH_CONST 1
+DEPOSIT c1
+LINE 426
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_201
+LINE 427
+PUSH_CONST 1
+DEPOSIT c1
+LINE 428
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_202
+LINE 429
+PUSH_CONST 1
+DEPOSIT c4
+LINE 430
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_203
+LINE 431
+PUSH_CONST 1
+DEPOSIT c1
+LINE 432
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_204
+LINE 433
+PUSH_CONST 1
+DEPOSIT c4
+LINE 434
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_205
+LINE 435
+PUSH_CONST 1
+DEPOSIT c5
+LINE 436
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_206
+LINE 437
+PUSH_CONST 1
+DEPOSIT c0
+LINE 438
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_207
+LINE 439
+PUSH_CONST 1
+DEPOSIT c7
+LINE 440
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_208
+LINE 441
+PUSH_CONST 1
+DEPOSIT c5
+LINE 442
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_209
+LINE 443
+PUSH_CONST 1
+DEPOSIT c6
+LINE 444
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_210
+LINE 445
+PUSH_CONST 1
+DEPOSIT c7
+LINE 446
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_211
+LINE 447
+PUSH_CONST 1
+DEPOSIT c6
+LINE 448
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_212
+LINE 449
+PUSH_CONST 1
+DEPOSIT c3
+LINE 450
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_213
+LINE 451
+PUSH_CONST 1
+DEPOSIT c4
+LINE 452
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_214
+LINE 453
+PUSH_CONST 1
+DEPOSIT c7
+LINE 454
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_215
+LINE 455
+PUSH_CONST 1
+DEPOSIT c4
+LINE 456
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_216
+LINE 457
+PUSH_CONST 1
+DEPOSIT c7
+LINE 458
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_217
+LINE 459
+PUSH_CONST 1
+DEPOSIT c5
+LINE 460
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_218
+LINE 461
+PUSH_CONST 1
+DEPOSIT c6
+LINE 462
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_219
+LINE 463
+PUSH_CONST 1
+DEPOSIT c6
+LINE 464
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_220
+LINE 465
+PUSH_CONST 1
+DEPOSIT c1
+LINE 466
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_221
+LINE 467
+PUSH_CONST 1
+DEPOSIT c3
+LINE 468
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_222
+LINE 469
+PUSH_CONST 1
+DEPOSIT c0
+LINE 470
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_223
+LINE 471
+PUSH_CONST 1
+DEPOSIT c2
+LINE 472
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_224
+LINE 473
+PUSH_CONST 1
+DEPOSIT c4
+LINE 474
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_225
+LINE 475
+PUSH_CONST 1
+DEPOSIT c1
+LINE 476
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_226
+LINE 477
+PUSH_CONST 1
+DEPOSIT c5
+LINE 478
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_227
+LINE 479
+PUSH_CONST 1
+DEPOSIT c6
+LINE 480
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_228
+LINE 481
+PUSH_CONST 1
+DEPOSIT c2
+LINE 482
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_229
+LINE 483
+PUSH_CONST 1
+DEPOSIT c4
+LINE 484
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_230
+LINE 485
+PUSH_CONST 1
+DEPOSIT c2
+LINE 486
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_231
+LINE 487
+PUSH_CONST 1
+DEPOSIT c0
+LINE 488
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_232
+LINE 489
+PUSH_CONST 1
+DEPOSIT c1
+LINE 490
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_233
+LINE 491
+PUSH_CONST 1
+DEPOSIT c1
+LINE 492
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_234
+LINE 493
+PUSH_CONST 1
+DEPOSIT c1
+LINE 494
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_235
+LINE 495
+PUSH_CONST 1
+DEPOSIT c0
+LINE 496
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_236
+LINE 497
+PUSH_CONST 1
+DEPOSIT c2
+LINE 498
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_237
+LINE 499
+PUSH_CONST 1
+DEPOSIT c6
+LINE 500
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_238
+LINE 501
+PUSH_CONST 1
+DEPOSIT c4
+LINE 502
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_239
+LINE 503
+PUSH_CONST 1
+DEPOSIT c3
+LINE 504
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_240
+LINE 505
+PUSH_CONST 1
+DEPOSIT c5
+LINE 506
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_241
+LINE 507
+PUSH_CONST 1
+DEPOSIT c1
+LINE 508
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_242
+LINE 509
+PUSH_CONST 1
+DEPOSIT c5
+LINE 510
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_243
+LINE 511
+PUSH_CONST 1
+DEPOSIT c0
+LINE 512
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_244
+LINE 513
+PUSH_CONST 1
+DEPOSIT c4
+LINE 514
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_245
+LINE 515
+PUSH_CONST 1
+DEPOSIT c5
+LINE 516
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_246
+LINE 517
+PUSH_CONST 1
+DEPOSIT c6
+LINE 518
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_247
+LINE 519
+PUSH_CONST 1
+DEPOSIT c2
+LINE 520
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_248
+LINE 521
+PUSH_CONST 1
+DEPOSIT c4
+LINE 522
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_249
+LINE 523
+PUSH_CONST 1
+DEPOSIT c3
+LINE 524
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_250
+LINE 525
+PUSH_CONST 1
+DEPOSIT c3
+LINE 526
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_251
+LINE 527
+PUSH_CONST 1
+DEPOSIT c6
+LINE 528
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_252
+LINE 529
+PUSH_CONST 1
+DEPOSIT c6
+LINE 530
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_253
+LINE 531
+PUSH_CONST 1
+DEPOSIT c4
+LINE 532
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_254
+LINE 533
+PUSH_CONST 1
+DEPOSIT c1
+LINE 534
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_255
+LINE 535
+PUSH_CONST 1
+DEPOSIT c7
+LINE 536
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_256
+LINE 537
+PUSH_CONST 1
+DEPOSIT c4
+LINE 538
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_257
+LINE 539
+PUSH_CONST 1
+DEPOSIT c2
+LINE 540
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_258
+LINE 541
+PUSH_CONST 1
+DEPOSIT c2
+LINE 542
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_259
+LINE 543
+PUSH_CONST 1
+DEPOSIT c5
+LINE 544
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_260
+LINE 545
+PUSH_CONST 1
+DEPOSIT c6
+LINE 546
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_261
+LINE 547
+PUSH_CONST 1
+DEPOSIT c1
+LINE 548
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_262
+LINE 549
+PUSH_CONST 1
+DEPOSIT c4
+LINE 550
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_263
+LINE 551
+PUSH_CONST 1
+DEPOSIT c1
+LINE 552
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_264
+LINE 553
+PUSH_CONST 1
+DEPOSIT c6
+LINE 554
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_265
+LINE 555
+PUSH_CONST 1
+DEPOSIT c7
+LINE 556
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_266
+LINE 557
+PUSH_CONST 1
+DEPOSIT c2
+LINE 558
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_267
+LINE 559
+PUSH_CONST 1
+DEPOSIT c0
+LINE 560
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_268
+LINE 561
+PUSH_CONST 1
+DEPOSIT c3
+LINE 562
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_269
+LINE 563
+PUSH_CONST 1
+DEPOSIT c7
+LINE 564
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_270
+LINE 565
+PUSH_CONST 1
+DEPOSIT c5
+LINE 566
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_271
+LINE 567
+PUSH_CONST 1
+DEPOSIT c1
+LINE 568
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_272
+LINE 569
+PUSH_CONST 1
+DEPOSIT c1
+LINE 570
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_273
+LINE 571
+PUSH_CONST 1
+DEPOSIT c6
+LINE 572
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_274
+LINE 573
+PUSH_CONST 1
+DEPOSIT c7
+LINE 574
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_275
+LINE 575
+PUSH_CONST 1
+DEPOSIT c6
+LINE 576
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_276
+LINE 577
+PUSH_CONST 1
+DEPOSIT c3
+LINE 578
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_277
+LINE 579
+PUSH_CONST 1
+DEPOSIT c4
+LINE 580
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_278
+LINE 581
+PUSH_CONST 1
+DEPOSIT c6
+LINE 582
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_279
+LINE 583
+PUSH_CONST 1
+DEPOSIT c7
+LINE 584
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_280
+LINE 585
+PUSH_CONST 1
+DEPOSIT c5
+LINE 586
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_281
+LINE 587
+PUSH_CONST 1
+DEPOSIT c1
+LINE 588
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_282
+LINE 589
+PUSH_CONST 1
+DEPOSIT c1
+LINE 590
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_283
+LINE 591
+PUSH_CONST 1
+DEPOSIT c0
+LINE 592
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_284
+LINE 593
+PUSH_CONST 1
+DEPOSIT c7
+LINE 594
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_285
+LINE 595
+PUSH_CONST 1
+DEPOSIT c6
+LINE 596
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_286
+LINE 597
+PUSH_CONST 1
+DEPOSIT c3
+LINE 598
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_287
+LINE 599
+PUSH_CONST 1
+DEPOSIT c2
+LINE 600
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_288
+LINE 601
+PUSH_CONST 1
+DEPOSIT c0
+LINE 602
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_289
+LINE 603
+PUSH_CONST 1
+DEPOSIT c6
+LINE 604
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_290
+LINE 605
+PUSH_CONST 1
+DEPOSIT c0
+LINE 606
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_291
+LINE 607
+PUSH_CONST 1
+DEPOSIT c4
+LINE 608
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_292
+LINE 609
+PUSH_CONST 1
+DEPOSIT c1
+LINE 610
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_293
+LINE 611
+PUSH_CONST 1
+DEPOSIT c4
+LINE 612
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_294
+LINE 613
+PUSH_CONST 1
+DEPOSIT c0
+LINE 614
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_295
+LINE 615
+PUSH_CONST 1
+DEPOSIT c2
+LINE 616
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_296
+LINE 617
+PUSH_CONST 1
+DEPOSIT c4
+LINE 618
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_297
+LINE 619
+PUSH_CONST 1
+DEPOSIT c6
+LINE 620
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_298
+LINE 621
+PUSH_CONST 1
+DEPOSIT c3
+LINE 622
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_299
+LINE 623
+PUSH_CONST 1
+DEPOSIT c7
+LINE 624
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_300
+LINE 625
+PUSH_CONST 1
+DEPOSIT c4
+LINE 626
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_301
+LINE 627
+PUSH_CONST 1
+DEPOSIT c7
+LINE 628
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_302
+LINE 629
+PUSH_CONST 1
+DEPOSIT c5
+LINE 630
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_303
+LINE 631
+PUSH_CONST 1
+DEPOSIT c4
+LINE 632
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_304
+LINE 633
+PUSH_CONST 1
+DEPOSIT c3
+LINE 634
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_305
+LINE 635
+PUSH_CONST 1
+DEPOSIT c2
+LINE 636
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_306
+LINE 637
+PUSH_CONST 1
+DEPOSIT c6
+LINE 638
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_307
+LINE 639
+PUSH_CONST 1
+DEPOSIT c5
+LINE 640
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_308
+LINE 641
+PUSH_CONST 1
+DEPOSIT c3
+LINE 642
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_309
+LINE 643
+PUSH_CONST 1
+DEPOSIT c1
+LINE 644
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_310
+LINE 645
+PUSH_CONST 1
+DEPOSIT c1
+LINE 646
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_311
+LINE 647
+PUSH_CONST 1
+DEPOSIT c2
+LINE 648
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_312
+LINE 649
+PUSH_CONST 1
+DEPOSIT c2
+LINE 650
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_313
+LINE 651
+PUSH_CONST 1
+DEPOSIT c3
+LINE 652
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_314
+LINE 653
+PUSH_CONST 1
+DEPOSIT c0
+LINE 654
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_315
+LINE 655
+PUSH_CONST 1
+DEPOSIT c1
+LINE 656
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_316
+LINE 657
+PUSH_CONST 1
+DEPOSIT c5
+LINE 658
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_317
+LINE 659
+PUSH_CONST 1
+DEPOSIT c5
+LINE 660
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_318
+LINE 661
+PUSH_CONST 1
+DEPOSIT c2
+LINE 662
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_319
+LINE 663
+PUSH_CONST 1
+DEPOSIT c7
+LINE 664
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_320
+LINE 665
+PUSH_CONST 1
+DEPOSIT c6
+LINE 666
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_321
+LINE 667
+PUSH_CONST 1
+DEPOSIT c0
+LINE 668
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_322
+LINE 669
+PUSH_CONST 1
+DEPOSIT c1
+LINE 670
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_323
+LINE 671
+PUSH_CONST 1
+DEPOSIT c5
+LINE 672
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_324
+LINE 673
+PUSH_CONST 1
+DEPOSIT c4
+LINE 674
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_325
+LINE 675
+PUSH_CONST 1
+DEPOSIT c6
+LINE 676
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_326
+LINE 677
+PUSH_CONST 1
+DEPOSIT c4
+LINE 678
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_327
+LINE 679
+PUSH_CONST 1
+DEPOSIT c2
+LINE 680
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_328
+LINE 681
+PUSH_CONST 1
+DEPOSIT c6
+LINE 682
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_329
+LINE 683
+PUSH_CONST 1
+DEPOSIT c4
+LINE 684
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_330
+LINE 685
+PUSH_CONST 1
+DEPOSIT c6
+LINE 686
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_331
+LINE 687
+PUSH_CONST 1
+DEPOSIT c3
+LINE 688
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_332
+LINE 689
+PUSH_CONST 1
+DEPOSIT c5
+LINE 690
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_333
+LINE 691
+PUSH_CONST 1
+DEPOSIT c7
+LINE 692
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_334
+LINE 693
+PUSH_CONST 1
+DEPOSIT c2
+LINE 694
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_335
+LINE 695
+PUSH_CONST 1
+DEPOSIT c0
+LINE 696
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_336
+LINE 697
+PUSH_CONST 1
+DEPOSIT c2
+LINE 698
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_337
+LINE 699
+PUSH_CONST 1
+DEPOSIT c5
+LINE 700
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_338
+LINE 701
+PUSH_CONST 1
+DEPOSIT c5
+LINE 702
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_339
+LINE 703
+PUSH_CONST 1
+DEPOSIT c6
+LINE 704
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_340
+LINE 705
+PUSH_CONST 1
+DEPOSIT c2
+LINE 706
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_341
+LINE 707
+PUSH_CONST 1
+DEPOSIT c0
+LINE 708
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_342
+LINE 709
+PUSH_CONST 1
+DEPOSIT c5
+LINE 710
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_343
+LINE 711
+PUSH_CONST 1
+DEPOSIT c4
+LINE 712
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_344
+LINE 713
+PUSH_CONST 1
+DEPOSIT c5
+LINE 714
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_345
+LINE 715
+PUSH_CONST 1
+DEPOSIT c5
+LINE 716
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_346
+LINE 717
+PUSH_CONST 1
+DEPOSIT c1
+LINE 718
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_347
+LINE 719
+PUSH_CONST 1
+DEPOSIT c5
+LINE 720
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_348
+LINE 721
+PUSH_CONST 1
+DEPOSIT c5
+LINE 722
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_349
+LINE 723
+PUSH_CONST 1
+DEPOSIT c7
+LINE 724
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_350
+LINE 725
+PUSH_CONST 1
+DEPOSIT c7
+LINE 726
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_351
+LINE 727
+PUSH_CONST 1
+DEPOSIT c5
+LINE 728
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_352
+LINE 729
+PUSH_CONST 1
+DEPOSIT c1
+LINE 730
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_353
+LINE 731
+PUSH_CONST 1
+DEPOSIT c2
+LINE 732
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_354
+LINE 733
+PUSH_CONST 1
+DEPOSIT c7
+LINE 734
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_355
+LINE 735
+PUSH_CONST 1
+DEPOSIT c3
+LINE 736
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_356
+LINE 737
+PUSH_CONST 1
+DEPOSIT c5
+LINE 738
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_357
+LINE 739
+PUSH_CONST 1
+DEPOSIT c6
+LINE 740
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_358
+LINE 741
+PUSH_CONST 1
+DEPOSIT c7
+LINE 742
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_359
+LINE 743
+PUSH_CONST 1
+DEPOSIT c2
+LINE 744
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_360
+LINE 745
+PUSH_CONST 1
+DEPOSIT c2
+LINE 746
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_361
+LINE 747
+PUSH_CONST 1
+DEPOSIT c3
+LINE 748
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_362
+LINE 749
+PUSH_CONST 1
+DEPOSIT c1
+LINE 750
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_363
+LINE 751
+PUSH_CONST 1
+DEPOSIT c6
+LINE 752
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_364
+LINE 753
+PUSH_CONST 1
+DEPOSIT c1
+LINE 754
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_365
+LINE 755
+PUSH_CONST 1
+DEPOSIT c1
+LINE 756
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_366
+LINE 757
+PUSH_CONST 1
+DEPOSIT c4
+LINE 758
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_367
+LINE 759
+PUSH_CONST 1
+DEPOSIT c1
+LINE 760
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_368
+LINE 761
+PUSH_CONST 1
+DEPOSIT c3
+LINE 762
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_369
+LINE 763
+PUSH_CONST 1
+DEPOSIT c6
+LINE 764
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_370
+LINE 765
+PUSH_CONST 1
+DEPOSIT c5
+LINE 766
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_371
+LINE 767
+PUSH_CONST 1
+DEPOSIT c4
+LINE 768
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_372
+LINE 769
+PUSH_CONST 1
+DEPOSIT c3
+LINE 770
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_373
+LINE 771
+PUSH_CONST 1
+DEPOSIT c3
+LINE 772
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_374
+LINE 773
+PUSH_CONST 1
+DEPOSIT c7
+LINE 774
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_375
+LINE 775
+PUSH_CONST 1
+DEPOSIT c3
+LINE 776
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_376
+LINE 777
+PUSH_CONST 1
+DEPOSIT c1
+LINE 778
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_377
+LINE 779
+PUSH_CONST 1
+DEPOSIT c6
+LINE 780
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_378
+LINE 781
+PUSH_CONST 1
+DEPOSIT c0
+LINE 782
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_379
+LINE 783
+PUSH_CONST 1
+DEPOSIT c7
+LINE 784
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_380
+LINE 785
+PUSH_CONST 1
+DEPOSIT c6
+LINE 786
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_381
+LINE 787
+PUSH_CONST 1
+DEPOSIT c0
+LINE 788
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_382
+LINE 789
+PUSH_CONST 1
+DEPOSIT c7
+LINE 790
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_383
+LINE 791
+PUSH_CONST 1
+DEPOSIT c3
+LINE 792
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_384
+LINE 793
+PUSH_CONST 1
+DEPOSIT c0
+LINE 794
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_385
+LINE 795
+PUSH_CONST 1
+DEPOSIT c4
+LINE 796
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_386
+LINE 797
+PUSH_CONST 1
+DEPOSIT c4
+LINE 798
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_387
+LINE 799
+PUSH_CONST 1
+DEPOSIT c6
+LINE 800
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_388
+LINE 801
+PUSH_CONST 1
+DEPOSIT c7
+LINE 802
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_389
+LINE 803
+PUSH_CONST 1
+DEPOSIT c2
+LINE 804
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_390
+LINE 805
+PUSH_CONST 1
+DEPOSIT c2
+LINE 806
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_391
+LINE 807
+PUSH_CONST 1
+DEPOSIT c4
+LINE 808
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_392
+LINE 809
+PUSH_CONST 1
+DEPOSIT c6
+LINE 810
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_393
+LINE 811
+PUSH_CONST 1
+DEPOSIT c5
+LINE 812
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_394
+LINE 813
+PUSH_CONST 1
+DEPOSIT c6
+LINE 814
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_395
+LINE 815
+PUSH_CONST 1
+DEPOSIT c0
+LINE 816
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_396
+LINE 817
+PUSH_CONST 1
+DEPOSIT c1
+LINE 818
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_397
+LINE 819
+PUSH_CONST 1
+DEPOSIT c6
+LINE 820
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_398
+LINE 821
+PUSH_CONST 1
+DEPOSIT c7
+LINE 822
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_399
+LINE 823
+PUSH_CONST 1
+DEPOSIT c5
+LINE 824
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_400
+LINE 825
+PUSH_CONST 1
+DEPOSIT c5
+LINE 826
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_401
+LINE 827
+PUSH_CONST 1
+DEPOSIT c7
+LINE 828
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_402
+LINE 829
+PUSH_CONST 1
+DEPOSIT c7
+LINE 830
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_403
+LINE 831
+PUSH_CONST 1
+DEPOSIT c2
+LINE 832
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_404
+LINE 833
+PUSH_CONST 1
+DEPOSIT c2
+LINE 834
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_405
+LINE 835
+PUSH_CONST 1
+DEPOSIT c2
+LINE 836
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_406
+LINE 837
+PUSH_CONST 1
+DEPOSIT c5
+LINE 838
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_407
+LINE 839
+PUSH_CONST 1
+DEPOSIT c4
+LINE 840
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_408
+LINE 841
+PUSH_CONST 1
+DEPOSIT c4
+LINE 842
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_409
+LINE 843
+PUSH_CONST 1
+DEPOSIT c6
+LINE 844
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_410
+LINE 845
+PUSH_CONST 1
+DEPOSIT c6
+LINE 846
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_411
+LINE 847
+PUSH_CONST 1
+DEPOSIT c7
+LINE 848
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_412
+LINE 849
+PUSH_CONST 1
+DEPOSIT c7
+LINE 850
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_413
+LINE 851
+PUSH_CONST 1
+DEPOSIT c6
+LINE 852
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_414
+LINE 853
+PUSH_CONST 1
+DEPOSIT c1
+LINE 854
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_415
+LINE 855
+PUSH_CONST 1
+DEPOSIT c3
+LINE 856
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_416
+LINE 857
+PUSH_CONST 1
+DEPOSIT c3
+LINE 858
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_417
+LINE 859
+PUSH_CONST 1
+DEPOSIT c1
+LINE 860
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_418
+LINE 861
+PUSH_CONST 1
+DEPOSIT c2
+LINE 862
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_419
+LINE 863
+PUSH_CONST 1
+DEPOSIT c1
+LINE 864
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_420
+LINE 865
+PUSH_CONST 1
+DEPOSIT c2
+LINE 866
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_421
+LINE 867
+PUSH_CONST 1
+DEPOSIT c1
+LINE 868
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_422
+LINE 869
+PUSH_CONST 1
+DEPOSIT c0
+LINE 870
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_423
+LINE 871
+PUSH_CONST 1
+DEPOSIT c6
+LINE 872
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_424
+LINE 873
+PUSH_CONST 1
+DEPOSIT c0
+LINE 874
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_425
+LINE 875
+PUSH_CONST 1
+DEPOSIT c6
+LINE 876
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_426
+LINE 877
+PUSH_CONST 1
+DEPOSIT c4
+LINE 878
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_427
+LINE 879
+PUSH_CONST 1
+DEPOSIT c2
+LINE 880
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_428
+LINE 881
+PUSH_CONST 1
+DEPOSIT c0
+LINE 882
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_429
+LINE 883
+PUSH_CONST 1
+DEPOSIT c1
+LINE 884
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_430
+LINE 885
+PUSH_CONST 1
+DEPOSIT c1
+LINE 886
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_431
+LINE 887
+PUSH_CONST 1
+DEPOSIT c4
+LINE 888
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_432
+LINE 889
+PUSH_CONST 1
+DEPOSIT c6
+LINE 890
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_433
+LINE 891
+PUSH_CONST 1
+DEPOSIT c7
+LINE 892
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_434
+LINE 893
+PUSH_CONST 1
+DEPOSIT c2
+LINE 894
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_435
+LINE 895
+PUSH_CONST 1
+DEPOSIT c3
+LINE 896
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_436
+LINE 897
+PUSH_CONST 1
+DEPOSIT c4
+LINE 898
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_437
+LINE 899
+PUSH_CONST 1
+DEPOSIT c4
+LINE 900
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_438
+LINE 901
+PUSH_CONST 1
+DEPOSIT c3
+LINE 902
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_439
+LINE 903
+PUSH_CONST 1
+DEPOSIT c7
+LINE 904
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_440
+LINE 905
+PUSH_CONST 1
+DEPOSIT c0
+LINE 906
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_441
+LINE 907
+PUSH_CONST 1
+DEPOSIT c4
+LINE 908
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_442
+LINE 909
+PUSH_CONST 1
+DEPOSIT c7
+LINE 910
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_443
+LINE 911
+PUSH_CONST 1
+DEPOSIT c1
+LINE 912
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_444
+LINE 913
+PUSH_CONST 1
+DEPOSIT c4
+LINE 914
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_445
+LINE 915
+PUSH_CONST 1
+DEPOSIT c3
+LINE 916
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_446
+LINE 917
+PUSH_CONST 1
+DEPOSIT c2
+LINE 918
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_447
+LINE 919
+PUSH_CONST 1
+DEPOSIT c4
+LINE 920
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_448
+LINE 921
+PUSH_CONST 1
+DEPOSIT c6
+LINE 922
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_449
+LINE 923
+PUSH_CONST 1
+DEPOSIT c2
+LINE 924
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_450
+LINE 925
+PUSH_CONST 1
+DEPOSIT c4
+LINE 926
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_451
+LINE 927
+PUSH_CONST 1
+DEPOSIT c7
+LINE 928
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_452
+LINE 929
+PUSH_CONST 1
+DEPOSIT c4
+LINE 930
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_453
+LINE 931
+PUSH_CONST 1
+DEPOSIT c3
+LINE 932
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_454
+LINE 933
+PUSH_CONST 1
+DEPOSIT c5
+LINE 934
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_455
+LINE 935
+PUSH_CONST 1
+DEPOSIT c3
+LINE 936
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_456
+LINE 937
+PUSH_CONST 1
+DEPOSIT c2
+LINE 938
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_457
+LINE 939
+PUSH_CONST 1
+DEPOSIT c7
+LINE 940
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_458
+LINE 941
+PUSH_CONST 1
+DEPOSIT c0
+LINE 942
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_459
+LINE 943
+PUSH_CONST 1
+DEPOSIT c2
+LINE 944
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_460
+LINE 945
+PUSH_CONST 1
+DEPOSIT c5
+LINE 946
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_461
+LINE 947
+PUSH_CONST 1
+DEPOSIT c7
+LINE 948
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_462
+LINE 949
+PUSH_CONST 1
+DEPOSIT c1
+LINE 950
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_463
+LINE 951
+PUSH_CONST 1
+DEPOSIT c2
+LINE 952
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_464
+LINE 953
+PUSH_CONST 1
+DEPOSIT c3
+LINE 954
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_465
+LINE 955
+PUSH_CONST 1
+DEPOSIT c0
+LINE 956
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_466
+LINE 957
+PUSH_CONST 1
+DEPOSIT c1
+LINE 958
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_467
+LINE 959
+PUSH_CONST 1
+DEPOSIT c3
+LINE 960
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_468
+LINE 961
+PUSH_CONST 1
+DEPOSIT c6
+LINE 962
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_469
+LINE 963
+PUSH_CONST 1
+DEPOSIT c0
+LINE 964
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_470
+LINE 965
+PUSH_CONST 1
+DEPOSIT c4
+LINE 966
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_471
+LINE 967
+PUSH_CONST 1
+DEPOSIT c1
+LINE 968
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_472
+LINE 969
+PUSH_CONST 1
+DEPOSIT c4
+LINE 970
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_473
+LINE 971
+PUSH_CONST 1
+DEPOSIT c4
+LINE 972
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_474
+LINE 973
+PUSH_CONST 1
+DEPOSIT c0
+LINE 974
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_475
+LINE 975
+PUSH_CONST 1
+DEPOSIT c5
+LINE 976
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_476
+LINE 977
+PUSH_CONST 1
+DEPOSIT c2
+LINE 978
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_477
+LINE 979
+PUSH_CONST 1
+DEPOSIT c4
+LINE 980
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_478
+LINE 981
+PUSH_CONST 1
+DEPOSIT c0
+LINE 982
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_479
+LINE 983
+PUSH_CONST 1
+DEPOSIT c1
+LINE 984
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_480
+LINE 985
+PUSH_CONST 1
+DEPOSIT c1
+LINE 986
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_481
+LINE 987
+PUSH_CONST 1
+DEPOSIT c5
+LINE 988
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_482
+LINE 989
+PUSH_CONST 1
+DEPOSIT c4
+LINE 990
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_483
+LINE 991
+PUSH_CONST 1
+DEPOSIT c5
+LINE 992
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_484
+LINE 993
+PUSH_CONST 1
+DEPOSIT c1
+LINE 994
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_485
+LINE 995
+PUSH_CONST 1
+DEPOSIT c6
+LINE 996
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_486
+LINE 997
+PUSH_CONST 1
+DEPOSIT c3
+LINE 998
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_487
+LINE 999
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1000
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_488
+LINE 1001
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1002
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_489
+LINE 1003
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1004
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_490
+LINE 1005
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1006
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_491
+LINE 1007
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1008
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_492
+LINE 1009
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1010
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_493
+LINE 1011
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1012
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_494
+LINE 1013
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1014
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_495
+LINE 1015
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1016
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_496
+LINE 1017
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1018
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_497
+LINE 1019
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1020
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_498
+LINE 1021
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1022
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_499
+LINE 1023
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1024
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_500
+LINE 1025
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1026
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_501
+LINE 1027
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1028
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_502
+LINE 1029
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1030
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_503
+LINE 1031
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1032
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_504
+LINE 1033
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1034
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_505
+LINE 1035
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1036
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_506
+LINE 1037
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1038
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_507
+LINE 1039
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1040
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_508
+LINE 1041
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1042
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_509
+LINE 1043
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1044
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_510
+LINE 1045
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1046
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_511
+LINE 1047
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1048
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_512
+LINE 1049
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1050
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_513
+LINE 1051
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1052
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_514
+LINE 1053
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1054
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_515
+LINE 1055
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1056
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_516
+LINE 1057
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1058
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_517
+LINE 1059
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1060
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_518
+LINE 1061
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1062
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_519
+LINE 1063
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1064
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_520
+LINE 1065
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1066
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_521
+LINE 1067
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1068
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_522
+LINE 1069
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1070
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_523
+LINE 1071
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1072
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_524
+LINE 1073
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1074
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_525
+LINE 1075
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1076
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_526
+LINE 1077
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1078
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_527
+LINE 1079
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1080
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_528
+LINE 1081
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1082
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_529
+LINE 1083
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1084
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_530
+LINE 1085
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1086
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_531
+LINE 1087
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1088
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_532
+LINE 1089
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1090
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_533
+LINE 1091
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1092
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_534
+LINE 1093
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1094
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_535
+LINE 1095
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1096
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_536
+LINE 1097
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1098
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_537
+LINE 1099
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1100
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_538
+LINE 1101
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1102
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_539
+LINE 1103
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1104
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_540
+LINE 1105
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1106
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_541
+LINE 1107
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1108
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_542
+LINE 1109
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1110
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_543
+LINE 1111
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1112
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_544
+LINE 1113
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1114
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_545
+LINE 1115
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1116
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_546
+LINE 1117
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1118
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_547
+LINE 1119
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1120
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_548
+LINE 1121
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1122
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_549
+LINE 1123
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1124
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_550
+LINE 1125
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1126
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_551
+LINE 1127
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1128
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_552
+LINE 1129
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1130
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_553
+LINE 1131
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1132
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_554
+LINE 1133
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1134
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_555
+LINE 1135
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1136
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_556
+LINE 1137
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1138
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_557
+LINE 1139
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1140
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_558
+LINE 1141
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1142
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_559
+LINE 1143
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1144
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_560
+LINE 1145
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1146
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_561
+LINE 1147
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1148
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_562
+LINE 1149
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1150
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_563
+LINE 1151
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1152
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_564
+LINE 1153
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1154
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_565
+LINE 1155
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1156
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_566
+LINE 1157
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1158
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_567
+LINE 1159
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1160
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_568
+LINE 1161
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1162
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_569
+LINE 1163
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1164
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_570
+LINE 1165
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1166
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_571
+LINE 1167
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1168
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_572
+LINE 1169
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1170
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_573
+LINE 1171
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1172
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_574
+LINE 1173
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1174
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_575
+LINE 1175
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1176
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_576
+LINE 1177
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1178
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_577
+LINE 1179
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1180
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_578
+LINE 1181
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1182
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_579
+LINE 1183
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1184
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_580
+LINE 1185
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1186
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_581
+LINE 1187
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1188
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_582
+LINE 1189
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1190
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_583
+LINE 1191
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1192
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_584
+LINE 1193
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1194
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_585
+LINE 1195
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1196
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_586
+LINE 1197
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1198
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_587
+LINE 1199
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1200
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_588
+LINE 1201
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1202
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_589
+LINE 1203
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1204
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_590
+LINE 1205
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1206
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_591
+LINE 1207
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1208
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_592
+LINE 1209
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1210
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_593
+LINE 1211
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1212
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_594
+LINE 1213
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1214
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_595
+LINE 1215
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1216
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_596
+LINE 1217
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1218
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_597
+LINE 1219
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1220
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_598
+LINE 1221
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1222
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_599
+LINE 1223
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1224
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_600
+LINE 1225
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1226
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_601
+LINE 1227
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1228
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_602
+LINE 1229
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1230
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_603
+LINE 1231
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1232
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_604
+LINE 1233
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1234
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_605
+LINE 1235
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1236
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_606
+LINE 1237
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1238
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_607
+LINE 1239
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1240
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_608
+LINE 1241
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1242
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_609
+LINE 1243
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1244
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_610
+LINE 1245
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1246
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_611
+LINE 1247
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1248
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_612
+LINE 1249
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1250
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_613
+LINE 1251
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1252
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_614
+LINE 1253
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1254
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_615
+LINE 1255
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1256
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_616
+LINE 1257
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1258
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_617
+LINE 1259
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1260
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_618
+LINE 1261
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1262
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_619
+LINE 1263
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1264
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_620
+LINE 1265
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1266
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_621
+LINE 1267
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1268
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_622
+LINE 1269
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1270
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_623
+LINE 1271
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1272
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_624
+LINE 1273
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1274
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_625
+LINE 1275
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1276
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_626
+LINE 1277
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1278
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_627
+LINE 1279
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1280
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_628
+LINE 1281
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1282
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_629
+LINE 1283
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1284
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_630
+LINE 1285
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1286
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_631
+LINE 1287
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1288
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_632
+LINE 1289
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1290
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_633
+LINE 1291
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1292
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_634
+LINE 1293
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1294
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_635
+LINE 1295
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1296
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_636
+LINE 1297
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1298
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_637
+LINE 1299
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1300
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_638
+LINE 1301
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1302
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_639
+LINE 1303
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1304
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_640
+LINE 1305
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1306
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_641
+LINE 1307
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1308
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_642
+LINE 1309
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1310
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_643
+LINE 1311
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1312
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_644
+LINE 1313
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1314
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_645
+LINE 1315
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1316
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_646
+LINE 1317
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1318
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_647
+LINE 1319
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1320
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_648
+LINE 1321
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1322
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_649
+LINE 1323
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1324
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_650
+LINE 1325
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1326
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_651
+LINE 1327
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1328
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_652
+LINE 1329
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1330
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_653
+LINE 1331
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1332
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_654
+LINE 1333
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1334
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_655
+LINE 1335
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1336
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_656
+LINE 1337
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1338
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_657
+LINE 1339
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1340
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_658
+LINE 1341
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1342
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_659
+LINE 1343
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1344
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_660
+LINE 1345
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1346
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_661
+LINE 1347
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1348
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_662
+LINE 1349
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1350
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_663
+LINE 1351
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1352
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_664
+LINE 1353
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1354
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_665
+LINE 1355
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1356
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_666
+LINE 1357
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1358
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_667
+LINE 1359
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1360
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_668
+LINE 1361
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1362
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_669
+LINE 1363
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1364
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_670
+LINE 1365
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1366
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_671
+LINE 1367
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1368
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_672
+LINE 1369
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1370
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_673
+LINE 1371
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1372
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_674
+LINE 1373
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1374
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_675
+LINE 1375
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1376
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_676
+LINE 1377
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1378
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_677
+LINE 1379
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1380
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_678
+LINE 1381
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1382
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_679
+LINE 1383
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1384
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_680
+LINE 1385
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1386
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_681
+LINE 1387
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1388
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_682
+LINE 1389
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1390
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_683
+LINE 1391
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1392
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_684
+LINE 1393
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1394
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_685
+LINE 1395
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1396
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_686
+LINE 1397
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1398
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_687
+LINE 1399
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1400
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_688
+LINE 1401
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1402
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_689
+LINE 1403
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1404
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_690
+LINE 1405
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1406
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_691
+LINE 1407
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1408
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_692
+LINE 1409
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1410
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_693
+LINE 1411
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1412
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_694
+LINE 1413
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1414
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_695
+LINE 1415
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1416
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_696
+LINE 1417
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1418
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_697
+LINE 1419
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1420
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_698
+LINE 1421
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1422
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_699
+LINE 1423
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1424
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_700
+LINE 1425
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1426
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_701
+LINE 1427
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1428
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_702
+LINE 1429
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1430
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_703
+LINE 1431
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1432
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_704
+LINE 1433
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1434
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_705
+LINE 1435
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1436
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_706
+LINE 1437
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1438
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_707
+LINE 1439
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1440
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_708
+LINE 1441
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1442
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_709
+LINE 1443
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1444
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_710
+LINE 1445
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1446
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_711
+LINE 1447
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1448
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_712
+LINE 1449
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1450
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_713
+LINE 1451
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1452
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_714
+LINE 1453
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1454
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_715
+LINE 1455
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1456
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_716
+LINE 1457
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1458
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_717
+LINE 1459
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1460
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_718
+LINE 1461
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1462
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_719
+LINE 1463
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1464
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_720
+LINE 1465
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1466
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_721
+LINE 1467
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1468
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_722
+LINE 1469
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1470
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_723
+LINE 1471
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1472
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_724
+LINE 1473
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1474
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_725
+LINE 1475
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1476
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_726
+LINE 1477
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1478
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_727
+LINE 1479
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1480
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_728
+LINE 1481
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1482
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_729
+LINE 1483
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1484
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_730
+LINE 1485
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1486
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_731
+LINE 1487
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1488
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_732
+LINE 1489
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1490
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_733
+LINE 1491
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1492
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_734
+LINE 1493
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1494
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_735
+LINE 1495
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1496
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_736
+LINE 1497
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1498
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_737
+LINE 1499
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1500
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_738
+LINE 1501
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1502
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_739
+LINE 1503
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1504
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_740
+LINE 1505
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1506
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_741
+LINE 1507
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1508
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_742
+LINE 1509
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1510
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_743
+LINE 1511
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1512
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_744
+LINE 1513
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1514
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_745
+LINE 1515
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1516
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_746
+LINE 1517
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1518
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_747
+LINE 1519
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1520
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_748
+LINE 1521
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1522
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_749
+LINE 1523
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1524
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_750
+LINE 1525
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1526
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_751
+LINE 1527
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1528
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_752
+LINE 1529
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1530
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_753
+LINE 1531
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1532
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_754
+LINE 1533
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1534
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_755
+LINE 1535
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1536
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_756
+LINE 1537
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1538
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_757
+LINE 1539
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1540
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_758
+LINE 1541
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1542
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_759
+LINE 1543
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1544
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_760
+LINE 1545
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1546
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_761
+LINE 1547
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1548
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_762
+LINE 1549
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1550
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_763
+LINE 1551
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1552
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_764
+LINE 1553
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1554
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_765
+LINE 1555
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1556
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_766
+LINE 1557
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1558
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_767
+LINE 1559
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1560
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_768
+LINE 1561
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1562
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_769
+LINE 1563
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1564
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_770
+LINE 1565
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1566
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_771
+LINE 1567
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1568
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_772
+LINE 1569
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1570
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_773
+LINE 1571
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1572
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_774
+LINE 1573
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1574
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_775
+LINE 1575
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1576
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_776
+LINE 1577
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1578
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_777
+LINE 1579
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1580
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_778
+LINE 1581
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1582
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_779
+LINE 1583
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1584
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_780
+LINE 1585
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1586
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_781
+LINE 1587
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1588
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_782
+LINE 1589
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1590
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_783
+LINE 1591
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1592
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_784
+LINE 1593
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1594
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_785
+LINE 1595
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1596
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_786
+LINE 1597
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1598
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_787
+LINE 1599
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1600
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_788
+LINE 1601
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1602
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_789
+LINE 1603
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1604
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_790
+LINE 1605
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1606
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_791
+LINE 1607
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1608
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_792
+LINE 1609
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1610
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_793
+LINE 1611
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1612
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_794
+LINE 1613
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1614
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_795
+LINE 1615
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1616
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_796
+LINE 1617
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1618
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_797
+LINE 1619
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1620
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_798
+LINE 1621
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1622
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_799
+LINE 1623
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1624
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_800
+LINE 1625
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1626
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_801
+LINE 1627
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1628
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_802
+LINE 1629
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1630
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_803
+LINE 1631
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1632
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_804
+LINE 1633
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1634
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_805
+LINE 1635
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1636
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_806
+LINE 1637
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1638
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_807
+LINE 1639
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1640
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_808
+LINE 1641
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1642
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_809
+LINE 1643
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1644
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_810
+LINE 1645
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1646
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_811
+LINE 1647
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1648
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_812
+LINE 1649
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1650
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_813
+LINE 1651
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1652
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_814
+LINE 1653
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1654
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_815
+LINE 1655
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1656
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_816
+LINE 1657
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1658
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_817
+LINE 1659
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1660
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_818
+LINE 1661
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1662
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_819
+LINE 1663
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1664
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_820
+LINE 1665
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1666
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_821
+LINE 1667
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1668
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_822
+LINE 1669
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1670
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_823
+LINE 1671
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1672
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_824
+LINE 1673
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1674
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_825
+LINE 1675
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1676
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_826
+LINE 1677
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1678
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_827
+LINE 1679
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1680
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_828
+LINE 1681
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1682
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_829
+LINE 1683
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1684
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_830
+LINE 1685
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1686
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_831
+LINE 1687
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1688
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_832
+LINE 1689
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1690
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_833
+LINE 1691
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1692
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_834
+LINE 1693
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1694
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_835
+LINE 1695
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1696
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_836
+LINE 1697
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1698
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_837
+LINE 1699
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1700
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_838
+LINE 1701
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1702
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_839
+LINE 1703
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1704
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_840
+LINE 1705
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1706
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_841
+LINE 1707
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1708
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_842
+LINE 1709
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1710
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_843
+LINE 1711
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1712
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_844
+LINE 1713
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1714
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_845
+LINE 1715
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1716
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_846
+LINE 1717
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1718
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_847
+LINE 1719
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1720
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_848
+LINE 1721
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1722
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_849
+LINE 1723
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1724
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_850
+LINE 1725
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1726
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_851
+LINE 1727
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1728
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_852
+LINE 1729
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1730
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_853
+LINE 1731
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1732
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_854
+LINE 1733
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1734
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_855
+LINE 1735
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1736
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_856
+LINE 1737
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1738
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_857
+LINE 1739
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1740
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_858
+LINE 1741
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1742
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_859
+LINE 1743
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1744
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_860
+LINE 1745
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1746
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_861
+LINE 1747
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1748
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_862
+LINE 1749
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1750
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_863
+LINE 1751
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1752
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_864
+LINE 1753
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1754
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_865
+LINE 1755
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1756
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_866
+LINE 1757
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1758
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_867
+LINE 1759
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1760
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_868
+LINE 1761
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1762
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_869
+LINE 1763
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1764
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_870
+LINE 1765
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1766
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_871
+LINE 1767
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1768
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_872
+LINE 1769
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1770
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_873
+LINE 1771
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1772
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_874
+LINE 1773
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1774
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_875
+LINE 1775
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1776
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_876
+LINE 1777
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1778
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_877
+LINE 1779
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1780
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_878
+LINE 1781
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1782
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_879
+LINE 1783
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1784
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_880
+LINE 1785
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1786
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_881
+LINE 1787
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1788
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_882
+LINE 1789
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1790
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_883
+LINE 1791
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1792
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_884
+LINE 1793
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1794
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_885
+LINE 1795
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1796
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_886
+LINE 1797
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1798
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_887
+LINE 1799
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1800
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_888
+LINE 1801
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1802
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_889
+LINE 1803
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1804
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_890
+LINE 1805
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1806
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_891
+LINE 1807
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1808
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_892
+LINE 1809
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1810
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_893
+LINE 1811
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1812
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_894
+LINE 1813
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1814
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_895
+LINE 1815
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1816
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_896
+LINE 1817
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1818
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_897
+LINE 1819
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1820
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_898
+LINE 1821
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1822
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_899
+LINE 1823
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1824
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_900
+LINE 1825
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1826
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_901
+LINE 1827
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1828
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_902
+LINE 1829
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1830
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_903
+LINE 1831
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1832
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_904
+LINE 1833
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1834
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_905
+LINE 1835
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1836
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_906
+LINE 1837
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1838
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_907
+LINE 1839
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1840
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_908
+LINE 1841
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1842
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_909
+LINE 1843
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1844
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_910
+LINE 1845
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1846
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_911
+LINE 1847
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1848
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_912
+LINE 1849
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1850
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_913
+LINE 1851
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1852
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_914
+LINE 1853
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1854
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_915
+LINE 1855
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1856
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_916
+LINE 1857
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1858
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_917
+LINE 1859
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1860
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_918
+LINE 1861
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1862
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_919
+LINE 1863
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1864
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_920
+LINE 1865
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1866
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_921
+LINE 1867
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1868
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_922
+LINE 1869
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1870
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_923
+LINE 1871
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1872
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_924
+LINE 1873
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1874
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_925
+LINE 1875
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1876
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_926
+LINE 1877
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1878
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_927
+LINE 1879
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1880
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_928
+LINE 1881
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1882
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_929
+LINE 1883
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1884
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_930
+LINE 1885
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1886
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_931
+LINE 1887
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1888
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_932
+LINE 1889
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1890
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_933
+LINE 1891
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1892
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_934
+LINE 1893
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1894
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_935
+LINE 1895
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1896
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_936
+LINE 1897
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1898
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_937
+LINE 1899
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1900
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_938
+LINE 1901
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1902
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_939
+LINE 1903
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1904
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_940
+LINE 1905
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1906
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_941
+LINE 1907
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1908
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_942
+LINE 1909
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1910
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_943
+LINE 1911
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1912
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_944
+LINE 1913
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1914
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_945
+LINE 1915
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1916
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_946
+LINE 1917
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1918
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_947
+LINE 1919
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1920
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_948
+LINE 1921
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1922
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_949
+LINE 1923
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1924
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_950
+LINE 1925
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1926
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_951
+LINE 1927
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1928
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_952
+LINE 1929
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1930
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_953
+LINE 1931
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1932
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_954
+LINE 1933
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1934
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_955
+LINE 1935
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1936
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_956
+LINE 1937
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1938
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_957
+LINE 1939
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1940
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_958
+LINE 1941
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1942
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_959
+LINE 1943
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1944
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_960
+LINE 1945
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1946
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_961
+LINE 1947
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1948
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_962
+LINE 1949
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1950
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_963
+LINE 1951
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1952
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_964
+LINE 1953
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1954
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_965
+LINE 1955
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1956
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_966
+LINE 1957
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1958
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_967
+LINE 1959
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1960
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_968
+LINE 1961
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1962
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_969
+LINE 1963
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1964
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_970
+LINE 1965
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1966
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_971
+LINE 1967
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1968
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_972
+LINE 1969
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1970
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_973
+LINE 1971
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1972
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_974
+LINE 1973
+PUSH_CONST 1
+DEPOSIT c4
+LINE 1974
+LOAD c2
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_975
+LINE 1975
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1976
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_976
+LINE 1977
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1978
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_977
+LINE 1979
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1980
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_978
+LINE 1981
+PUSH_CONST 1
+DEPOSIT c1
+LINE 1982
+LOAD c1
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_979
+LINE 1983
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1984
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_980
+LINE 1985
+PUSH_CONST 1
+DEPOSIT c7
+LINE 1986
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_981
+LINE 1987
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1988
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_982
+LINE 1989
+PUSH_CONST 1
+DEPOSIT c5
+LINE 1990
+LOAD c7
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_983
+LINE 1991
+PUSH_CONST 1
+DEPOSIT c6
+LINE 1992
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_984
+LINE 1993
+PUSH_CONST 1
+DEPOSIT c2
+LINE 1994
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_985
+LINE 1995
+PUSH_CONST 1
+DEPOSIT c3
+LINE 1996
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_986
+LINE 1997
+PUSH_CONST 1
+DEPOSIT c0
+LINE 1998
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_987
+LINE 1999
+PUSH_CONST 1
+DEPOSIT c0
+LINE 2000
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_988
+LINE 2001
+PUSH_CONST 1
+DEPOSIT c6
+LINE 2002
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_989
+LINE 2003
+PUSH_CONST 1
+DEPOSIT c5
+LINE 2004
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_990
+LINE 2005
+PUSH_CONST 1
+DEPOSIT c5
+LINE 2006
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_991
+LINE 2007
+PUSH_CONST 1
+DEPOSIT c3
+LINE 2008
+LOAD c4
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_992
+LINE 2009
+PUSH_CONST 1
+DEPOSIT c3
+LINE 2010
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_993
+LINE 2011
+PUSH_CONST 1
+DEPOSIT c6
+LINE 2012
+LOAD c6
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_994
+LINE 2013
+PUSH_CONST 1
+DEPOSIT c2
+LINE 2014
+LOAD c0
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_995
+LINE 2015
+PUSH_CONST 1
+DEPOSIT c6
+LINE 2016
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_996
+LINE 2017
+PUSH_CONST 1
+DEPOSIT c3
+LINE 2018
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_997
+LINE 2019
+PUSH_CONST 1
+DEPOSIT c1
+LINE 2020
+LOAD c5
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_998
+LINE 2021
+PUSH_CONST 1
+DEPOSIT c6
+LINE 2022
+LOAD c3
+PUSH_CONST 1
+NEG
+CMP_GT
+JMP_IF_FALSE endif_999
+LINE 2023
+PUSH_CONST 1
+DEPOSIT c4
+LABEL endif_999
+LABEL endif_998
+LABEL endif_997
+LABEL endif_996
+LABEL endif_995
+LABEL endif_994
+LABEL endif_993
+LABEL endif_992
+LABEL endif_991
+LABEL endif_990
+LABEL endif_989
+LABEL endif_988
+LABEL endif_987
+LABEL endif_986
+LABEL endif_985
+LABEL endif_984
+LABEL endif_983
+LABEL endif_982
+LABEL endif_981
+LABEL endif_980
+LABEL endif_979
+LABEL endif_978
+LABEL endif_977
+LABEL endif_976
+LABEL endif_975
+LABEL endif_974
+LABEL endif_973
+LABEL endif_972
+LABEL endif_971
+LABEL endif_970
+LABEL endif_969
+LABEL endif_968
+LABEL endif_967
+LABEL endif_966
+LABEL endif_965
+LABEL endif_964
+LABEL endif_963
+LABEL endif_962
+LABEL endif_961
+LABEL endif_960
+LABEL endif_959
+LABEL endif_958
+LABEL endif_957
+LABEL endif_956
+LABEL endif_955
+LABEL endif_954
+LABEL endif_953
+LABEL endif_952
+LABEL endif_951
+LABEL endif_950
+LABEL endif_949
+LABEL endif_948
+LABEL endif_947
+LABEL endif_946
+LABEL endif_945
+LABEL endif_944
+LABEL endif_943
+LABEL endif_942
+LABEL endif_941
+LABEL endif_940
+LABEL endif_939
+LABEL endif_938
+LABEL endif_937
+LABEL endif_936
+LABEL endif_935
+LABEL endif_934
+LABEL endif_933
+LABEL endif_932
+LABEL endif_931
+LABEL endif_930
+LABEL endif_929
+LABEL endif_928
+LABEL endif_927
+LABEL endif_926
+LABEL endif_925
+LABEL endif_924
+LABEL endif_923
+LABEL endif_922
+LABEL endif_921
+LABEL endif_920
+LABEL endif_919
+LABEL endif_918
+LABEL endif_917
+LABEL endif_916
+LABEL endif_915
+LABEL endif_914
+LABEL endif_913
+LABEL endif_912
+LABEL endif_911
+LABEL endif_910
+LABEL endif_909
+LABEL endif_908
+LABEL endif_907
+LABEL endif_906
+LABEL endif_905
+LABEL endif_904
+LABEL endif_903
+LABEL endif_902
+LABEL endif_901
+LABEL endif_900
+LABEL endif_899
+LABEL endif_898
+LABEL endif_897
+LABEL endif_896
+LABEL endif_895
+LABEL endif_894
+LABEL endif_893
+LABEL endif_892
+LABEL endif_891
+LABEL endif_890
+LABEL endif_889
+LABEL endif_888
+LABEL endif_887
+LABEL endif_886
+LABEL endif_885
+LABEL endif_884
+LABEL endif_883
+LABEL endif_882
+LABEL endif_881
+LABEL endif_880
+LABEL endif_879
+LABEL endif_878
+LABEL endif_877
+LABEL endif_876
+LABEL endif_875
+LABEL endif_874
+LABEL endif_873
+LABEL endif_872
+LABEL endif_871
+LABEL endif_870
+LABEL endif_869
+LABEL endif_868
+LABEL endif_867
+LABEL endif_866
+LABEL endif_865
+LABEL endif_864
+LABEL endif_863
+LABEL endif_862
+LABEL endif_861
+LABEL endif_860
+LABEL endif_859
+LABEL endif_858
+LABEL endif_857
+LABEL endif_856
+LABEL endif_855
+LABEL endif_854
+LABEL endif_853
+LABEL endif_852
+LABEL endif_851
+LABEL endif_850
+LABEL endif_849
+LABEL endif_848
+LABEL endif_847
+LABEL endif_846
+LABEL endif_845
+LABEL endif_844
+LABEL endif_843
+LABEL endif_842
+LABEL endif_841
+LABEL endif_840
+LABEL endif_839
+LABEL endif_838
+LABEL endif_837
+LABEL endif_836
+LABEL endif_835
+LABEL endif_834
+LABEL endif_833
+LABEL endif_832
+LABEL endif_831
+LABEL endif_830
+LABEL endif_829
+LABEL endif_828
+LABEL endif_827
+LABEL endif_826
+LABEL endif_825
+LABEL endif_824
+LABEL endif_823
+LABEL endif_822
+LABEL endif_821
+LABEL endif_820
+LABEL endif_819
+LABEL endif_818
+LABEL endif_817
+LABEL endif_816
+LABEL endif_815
+LABEL endif_814
+LABEL endif_813
+LABEL endif_812
+LABEL endif_811
+LABEL endif_810
+LABEL endif_809
+LABEL endif_808
+LABEL endif_807
+LABEL endif_806
+LABEL endif_805
+LABEL endif_804
+LABEL endif_803
+LABEL endif_802
+LABEL endif_801
+LABEL endif_800
+LABEL endif_799
+LABEL endif_798
+LABEL endif_797
+LABEL endif_796
+LABEL endif_795
+LABEL endif_794
+LABEL endif_793
+LABEL endif_792
+LABEL endif_791
+LABEL endif_790
+LABEL endif_789
+LABEL endif_788
+LABEL endif_787
+LABEL endif_786
+LABEL endif_785
+LABEL endif_784
+LABEL endif_783
+LABEL endif_782
+LABEL endif_781
+LABEL endif_780
+LABEL endif_779
+LABEL endif_778
+LABEL endif_777
+LABEL endif_776
+LABEL endif_775
+LABEL endif_774
+LABEL endif_773
+LABEL endif_772
+LABEL endif_771
+LABEL endif_770
+LABEL endif_769
+LABEL endif_768
+LABEL endif_767
+LABEL endif_766
+LABEL endif_765
+LABEL endif_764
+LABEL endif_763
+LABEL endif_762
+LABEL endif_761
+LABEL endif_760
+LABEL endif_759
+LABEL endif_758
+LABEL endif_757
+LABEL endif_756
+LABEL endif_755
+LABEL endif_754
+LABEL endif_753
+LABEL endif_752
+LABEL endif_751
+LABEL endif_750
+LABEL endif_749
+LABEL endif_748
+LABEL endif_747
+LABEL endif_746
+LABEL endif_745
+LABEL endif_744
+LABEL endif_743
+LABEL endif_742
+LABEL endif_741
+LABEL endif_740
+LABEL endif_739
+LABEL endif_738
+LABEL endif_737
+LABEL endif_736
+LABEL endif_735
+LABEL endif_734
+LABEL endif_733
+LABEL endif_732
+LABEL endif_731
+LABEL endif_730
+LABEL endif_729
+LABEL endif_728
+LABEL endif_727
+LABEL endif_726
+LABEL endif_725
+LABEL endif_724
+LABEL endif_723
+LABEL endif_722
+LABEL endif_721
+LABEL endif_720
+LABEL endif_719
+LABEL endif_718
+LABEL endif_717
+LABEL endif_716
+LABEL endif_715
+LABEL endif_714
+LABEL endif_713
+LABEL endif_712
+LABEL endif_711
+LABEL endif_710
+LABEL endif_709
+LABEL endif_708
+LABEL endif_707
+LABEL endif_706
+LABEL endif_705
+LABEL endif_704
+LABEL endif_703
+LABEL endif_702
+LABEL endif_701
+LABEL endif_700
+LABEL endif_699
+LABEL endif_698
+LABEL endif_697
+LABEL endif_696
+LABEL endif_695
+LABEL endif_694
+LABEL endif_693
+LABEL endif_692
+LABEL endif_691
+LABEL endif_690
+LABEL endif_689
+LABEL endif_688
+LABEL endif_687
+LABEL endif_686
+LABEL endif_685
+LABEL endif_684
+LABEL endif_683
+LABEL endif_682
+LABEL endif_681
+LABEL endif_680
+LABEL endif_679
+LABEL endif_678
+LABEL endif_677
+LABEL endif_676
+LABEL endif_675
+LABEL endif_674
+LABEL endif_673
+LABEL endif_672
+LABEL endif_671
+LABEL endif_670
+LABEL endif_669
+LABEL endif_668
+LABEL endif_667
+LABEL endif_666
+LABEL endif_665
+LABEL endif_664
+LABEL endif_663
+LABEL endif_662
+LABEL endif_661
+LABEL endif_660
+LABEL endif_659
+LABEL endif_658
+LABEL endif_657
+LABEL endif_656
+LABEL endif_655
+LABEL endif_654
+LABEL endif_653
+LABEL endif_652
+LABEL endif_651
+LABEL endif_650
+LABEL endif_649
+LABEL endif_648
+LABEL endif_647
+LABEL endif_646
+LABEL endif_645
+LABEL endif_644
+LABEL endif_643
+LABEL endif_642
+LABEL endif_641
+LABEL endif_640
+LABEL endif_639
+LABEL endif_638
+LABEL endif_637
+LABEL endif_636
+LABEL endif_635
+LABEL endif_634
+LABEL endif_633
+LABEL endif_632
+LABEL endif_631
+LABEL endif_630
+LABEL endif_629
+LABEL endif_628
+LABEL endif_627
+LABEL endif_626
+LABEL endif_625
+LABEL endif_624
+LABEL endif_623
+LABEL endif_622
+LABEL endif_621
+LABEL endif_620
+LABEL endif_619
+LABEL endif_618
+LABEL endif_617
+LABEL endif_616
+LABEL endif_615
+LABEL endif_614
+LABEL endif_613
+LABEL endif_612
+LABEL endif_611
+LABEL endif_610
+LABEL endif_609
+LABEL endif_608
+LABEL endif_607
+LABEL endif_606
+LABEL endif_605
+LABEL endif_604
+LABEL endif_603
+LABEL endif_602
+LABEL endif_601
+LABEL endif_600
+LABEL endif_599
+LABEL endif_598
+LABEL endif_597
+LABEL endif_596
+LABEL endif_595
+LABEL endif_594
+LABEL endif_593
+LABEL endif_592
+LABEL endif_591
+LABEL endif_590
+LABEL endif_589
+LABEL endif_588
+LABEL endif_587
+LABEL endif_586
+LABEL endif_585
+LABEL endif_584
+LABEL endif_583
+LABEL endif_582
+LABEL endif_581
+LABEL endif_580
+LABEL endif_579
+LABEL endif_578
+LABEL endif_577
+LABEL endif_576
+LABEL endif_575
+LABEL endif_574
+LABEL endif_573
+LABEL endif_572
+LABEL endif_571
+LABEL endif_570
+LABEL endif_569
+LABEL endif_568
+LABEL endif_567
+LABEL endif_566
+LABEL endif_565
+LABEL endif_564
+LABEL endif_563
+LABEL endif_562
+LABEL endif_561
+LABEL endif_560
+LABEL endif_559
+LABEL endif_558
+LABEL endif_557
+LABEL endif_556
+LABEL endif_555
+LABEL endif_554
+LABEL endif_553
+LABEL endif_552
+LABEL endif_551
+LABEL endif_550
+LABEL endif_549
+LABEL endif_548
+LABEL endif_547
+LABEL endif_546
+LABEL endif_545
+LABEL endif_544
+LABEL endif_543
+LABEL endif_542
+LABEL endif_541
+LABEL endif_540
+LABEL endif_539
+LABEL endif_538
+LABEL endif_537
+LABEL endif_536
+LABEL endif_535
+LABEL endif_534
+LABEL endif_533
+LABEL endif_532
+LABEL endif_531
+LABEL endif_530
+LABEL endif_529
+LABEL endif_528
+LABEL endif_527
+LABEL endif_526
+LABEL endif_525
+LABEL endif_524
+LABEL endif_523
+LABEL endif_522
+LABEL endif_521
+LABEL endif_520
+LABEL endif_519
+LABEL endif_518
+LABEL endif_517
+LABEL endif_516
+LABEL endif_515
+LABEL endif_514
+LABEL endif_513
+LABEL endif_512
+LABEL endif_511
+LABEL endif_510
+LABEL endif_509
+LABEL endif_508
+LABEL endif_507
+LABEL endif_506
+LABEL endif_505
+LABEL endif_504
+LABEL endif_503
+LABEL endif_502
+LABEL endif_501
+LABEL endif_500
+LABEL endif_499
+LABEL endif_498
+LABEL endif_497
+LABEL endif_496
+LABEL endif_495
+LABEL endif_494
+LABEL endif_493
+LABEL endif_492
+LABEL endif_491
+LABEL endif_490
+LABEL endif_489
+LABEL endif_488
+LABEL endif_487
+LABEL endif_486
+LABEL endif_485
+LABEL endif_484
+LABEL endif_483
+LABEL endif_482
+LABEL endif_481
+LABEL endif_480
+LABEL endif_479
+LABEL endif_478
+LABEL endif_477
+LABEL endif_476
+LABEL endif_475
+LABEL endif_474
+LABEL endif_473
+LABEL endif_472
+LABEL endif_471
+LABEL endif_470
+LABEL endif_469
+LABEL endif_468
+LABEL endif_467
+LABEL endif_466
+LABEL endif_465
+LABEL endif_464
+LABEL endif_463
+LABEL endif_462
+LABEL endif_461
+LABEL endif_460
+LABEL endif_459
+LABEL endif_458
+LABEL endif_457
+LABEL endif_456
+LABEL endif_455
+LABEL endif_454
+LABEL endif_453
+LABEL endif_452
+LABEL endif_451
+LABEL endif_450
+LABEL endif_449
+LABEL endif_448
+LABEL endif_447
+LABEL endif_446
+LABEL endif_445
+LABEL endif_444
+LABEL endif_443
+LABEL endif_442
+LABEL endif_441
+LABEL endif_440
+LABEL endif_439
+LABEL endif_438
+LABEL endif_437
+LABEL endif_436
+LABEL endif_435
+LABEL endif_434
+LABEL endif_433
+LABEL endif_432
+LABEL endif_431
+LABEL endif_430
+LABEL endif_429
+LABEL endif_428
+LABEL endif_427
+LABEL endif_426
+LABEL endif_425
+LABEL endif_424
+LABEL endif_423
+LABEL endif_422
+LABEL endif_421
+LABEL endif_420
+LABEL endif_419
+LABEL endif_418
+LABEL endif_417
+LABEL endif_416
+LABEL endif_415
+LABEL endif_414
+LABEL endif_413
+LABEL endif_412
+LABEL endif_411
+LABEL endif_410
+LABEL endif_409
+LABEL endif_408
+LABEL endif_407
+LABEL endif_406
+LABEL endif_405
+LABEL endif_404
+LABEL endif_403
+LABEL endif_402
+LABEL endif_401
+LABEL endif_400
+LABEL endif_399
+LABEL endif_398
+LABEL endif_397
+LABEL endif_396
+LABEL endif_395
+LABEL endif_394
+LABEL endif_393
+LABEL endif_392
+LABEL endif_391
+LABEL endif_390
+LABEL endif_389
+LABEL endif_388
+LABEL endif_387
+LABEL endif_386
+LABEL endif_385
+LABEL endif_384
+LABEL endif_383
+LABEL endif_382
+LABEL endif_381
+LABEL endif_380
+LABEL endif_379
+LABEL endif_378
+LABEL endif_377
+LABEL endif_376
+LABEL endif_375
+LABEL endif_374
+LABEL endif_373
+LABEL endif_372
+LABEL endif_371
+LABEL endif_370
+LABEL endif_369
+LABEL endif_368
+LABEL endif_367
+LABEL endif_366
+LABEL endif_365
+LABEL endif_364
+LABEL endif_363
+LABEL endif_362
+LABEL endif_361
+LABEL endif_360
+LABEL endif_359
+LABEL endif_358
+LABEL endif_357
+LABEL endif_356
+LABEL endif_355
+LABEL endif_354
+LABEL endif_353
+LABEL endif_352
+LABEL endif_351
+LABEL endif_350
+LABEL endif_349
+LABEL endif_348
+LABEL endif_347
+LABEL endif_346
+LABEL endif_345
+LABEL endif_344
+LABEL endif_343
+LABEL endif_342
+LABEL endif_341
+LABEL endif_340
+LABEL endif_339
+LABEL endif_338
+LABEL endif_337
+LABEL endif_336
+LABEL endif_335
+LABEL endif_334
+LABEL endif_333
+LABEL endif_332
+LABEL endif_331
+LABEL endif_330
+LABEL endif_329
+LABEL endif_328
+LABEL endif_327
+LABEL endif_326
+LABEL endif_325
+LABEL endif_324
+LABEL endif_323
+LABEL endif_322
+LABEL endif_321
+LABEL endif_320
+LABEL endif_319
+LABEL endif_318
+LABEL endif_317
+LABEL endif_316
+LABEL endif_315
+LABEL endif_314
+LABEL endif_313
+LABEL endif_312
+LABEL endif_311
+LABEL endif_310
+LABEL endif_309
+LABEL endif_308
+LABEL endif_307
+LABEL endif_306
+LABEL endif_305
+LABEL endif_304
+LABEL endif_303
+LABEL endif_302
+LABEL endif_301
+LABEL endif_300
+LABEL endif_299
+LABEL endif_298
+LABEL endif_297
+LABEL endif_296
+LABEL endif_295
+LABEL endif_294
+LABEL endif_293
+LABEL endif_292
+LABEL endif_291
+LABEL endif_290
+LABEL endif_289
+LABEL endif_288
+LABEL endif_287
+LABEL endif_286
+LABEL endif_285
+LABEL endif_284
+LABEL endif_283
+LABEL endif_282
+LABEL endif_281
+LABEL endif_280
+LABEL endif_279
+LABEL endif_278
+LABEL endif_277
+LABEL endif_276
+LABEL endif_275
+LABEL endif_274
+LABEL endif_273
+LABEL endif_272
+LABEL endif_271
+LABEL endif_270
+LABEL endif_269
+LABEL endif_268
+LABEL endif_267
+LABEL endif_266
+LABEL endif_265
+LABEL endif_264
+LABEL endif_263
+LABEL endif_262
+LABEL endif_261
+LABEL endif_260
+LABEL endif_259
+LABEL endif_258
+LABEL endif_257
+LABEL endif_256
+LABEL endif_255
+LABEL endif_254
+LABEL endif_253
+LABEL endif_252
+LABEL endif_251
+LABEL endif_250
+LABEL endif_249
+LABEL endif_248
+LABEL endif_247
+LABEL endif_246
+LABEL endif_245
+LABEL endif_244
+LABEL endif_243
+LABEL endif_242
+LABEL endif_241
+LABEL endif_240
+LABEL endif_239
+LABEL endif_238
+LABEL endif_237
+LABEL endif_236
+LABEL endif_235
+LABEL endif_234
+LABEL endif_233
+LABEL endif_232
+LABEL endif_231
+LABEL endif_230
+LABEL endif_229
+LABEL endif_228
+LABEL endif_227
+LABEL endif_226
+LABEL endif_225
+LABEL endif_224
+LABEL endif_223
+LABEL endif_222
+LABEL endif_221
+LABEL endif_220
+LABEL endif_219
+LABEL endif_218
+LABEL endif_217
+LABEL endif_216
+LABEL endif_215
+LABEL endif_214
+LABEL endif_213
+LABEL endif_212
+LABEL endif_211
+LABEL endif_210
+LABEL endif_209
+LABEL endif_208
+LABEL endif_207
+LABEL endif_206
+LABEL endif_205
+LABEL endif_204
+LABEL endif_203
+LABEL endif_202
+LABEL endif_201
+LABEL endif_200
+LABEL endif_199
+LABEL endif_198
+LABEL endif_197
+LABEL endif_196
+LABEL endif_195
+LABEL endif_194
+LABEL endif_193
+LABEL endif_192
+LABEL endif_191
+LABEL endif_190
+LABEL endif_189
+LABEL endif_188
+LABEL endif_187
+LABEL endif_186
+LABEL endif_185
+LABEL endif_184
+LABEL endif_183
+LABEL endif_182
+LABEL endif_181
+LABEL endif_180
+LABEL endif_179
+LABEL endif_178
+LABEL endif_177
+LABEL endif_176
+LABEL endif_175
+LABEL endif_174
+LABEL endif_173
+LABEL endif_172
+LABEL endif_171
+LABEL endif_170
+LABEL endif_169
+LABEL endif_168
+LABEL endif_167
+LABEL endif_166
+LABEL endif_165
+LABEL endif_164
+LABEL endif_163
+LABEL endif_162
+LABEL endif_161
+LABEL endif_160
+LABEL endif_159
+LABEL endif_158
+LABEL endif_157
+LABEL endif_156
+LABEL endif_155
+LABEL endif_154
+LABEL endif_153
+LABEL endif_152
+LABEL endif_151
+LABEL endif_150
+LABEL endif_149
+LABEL endif_148
+LABEL endif_147
+LABEL endif_146
+LABEL endif_145
+LABEL endif_144
+LABEL endif_143
+LABEL endif_142
+LABEL endif_141
+LABEL endif_140
+LABEL endif_139
+LABEL endif_138
+LABEL endif_137
+LABEL endif_136
+LABEL endif_135
+LABEL endif_134
+LABEL endif_133
+LABEL endif_132
+LABEL endif_131
+LABEL endif_130
+LABEL endif_129
+LABEL endif_128
+LABEL endif_127
+LABEL endif_126
+LABEL endif_125
+LABEL endif_124
+LABEL endif_123
+LABEL endif_122
+LABEL endif_121
+LABEL endif_120
+LABEL endif_119
+LABEL endif_118
+LABEL endif_117
+LABEL endif_116
+LABEL endif_115
+LABEL endif_114
+LABEL endif_113
+LABEL endif_112
+LABEL endif_111
+LABEL endif_110
+LABEL endif_109
+LABEL endif_108
+LABEL endif_107
+LABEL endif_106
+LABEL endif_105
+LABEL endif_104
+LABEL endif_103
+LABEL endif_102
+LABEL endif_101
+LABEL endif_100
+LABEL endif_99
+LABEL endif_98
+LABEL endif_97
+LABEL endif_96
+LABEL endif_95
+LABEL endif_94
+LABEL endif_93
+LABEL endif_92
+LABEL endif_91
+LABEL endif_90
+LABEL endif_89
+LABEL endif_88
+LABEL endif_87
+LABEL endif_86
+LABEL endif_85
+LABEL endif_84
+LABEL endif_83
+LABEL endif_82
+LABEL endif_81
+LABEL endif_80
+LABEL endif_79
+LABEL endif_78
+LABEL endif_77
+LABEL endif_76
+LABEL endif_75
+LABEL endif_74
+LABEL endif_73
+LABEL endif_72
+LABEL endif_71
+LABEL endif_70
+LABEL endif_69
+LABEL endif_68
+LABEL endif_67
+LABEL endif_66
+LABEL endif_65
+LABEL endif_64
+LABEL endif_63
+LABEL endif_62
+LABEL endif_61
+LABEL endif_60
+LABEL endif_59
+LABEL endif_58
+LABEL endif_57
+LABEL endif_56
+LABEL endif_55
+LABEL endif_54
+LABEL endif_53
+LABEL endif_52
+LABEL endif_51
+LABEL endif_50
+LABEL endif_49
+LABEL endif_48
+LABEL endif_47
+LABEL endif_46
+LABEL endif_45
+LABEL endif_44
+LABEL endif_43
+LABEL endif_42
+LABEL endif_41
+LABEL endif_40
+LABEL endif_39
+LABEL endif_38
+LABEL endif_37
+LABEL endif_36
+LABEL endif_35
+LABEL endif_34
+LABEL endif_33
+LABEL endif_32
+LABEL endif_31
+LABEL endif_30
+LABEL endif_29
+LABEL endif_28
+LABEL endif_27
+LABEL endif_26
+LABEL endif_25
+LABEL endif_24
+LABEL endif_23
+LABEL endif_22
+LABEL endif_21
+LABEL endif_20
+LABEL endif_19
+LABEL endif_18
+LABEL endif_17
+LABEL endif_16
+LABEL endif_15
+LABEL endif_14
+LABEL endif_13
+LABEL endif_12
+LABEL endif_11
+LABEL endif_10
+LABEL endif_9
+LABEL endif_8
+LABEL endif_7
+LABEL endif_6
+LABEL endif_5
+LABEL endif_4
+LABEL endif_3
+LABEL endif_2
+LABEL endif_1
+LABEL endif_0
+LINE 2024
+PRINT_STR_LITERAL "Saldo final:"
+LOAD c0
+PRINT
+LINE 0
+HALT
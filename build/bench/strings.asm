@@ -0,0 +1,268 @@
+# BankVM assembly generated by MoneyLang compiler
+LINE 2
+ACCOUNT_INIT c0
+PUSH_CONST 2301
+STORE c0
+LINE 3
+ACCOUNT_INIT c1
+PUSH_CONST 9425
+STORE c1
+LINE 4
+ACCOUNT_INIT c2
+PUSH_CONST 1133
+STORE c2
+LINE 5
+ACCOUNT_INIT c3
+PUSH_CONST 4279
+STORE c3
+LINE 6
+ACCOUNT_INIT c4
+PUSH_CONST 2031
+STORE c4
+LINE 7
+ACCOUNT_INIT c5
+PUSH_CONST 8217
+STORE c5
+LINE 8
+ACCOUNT_INIT c6
+PUSH_CONST 7464
+STORE c6
+LINE 9
+ACCOUNT_INIT c7
+PUSH_CONST 7837
+STORE c7
+LINE 10
+PUSH_CONST 83
+STORE v0
+LINE 11
+PUSH_CONST 48
+STORE v1
+LINE 12
+PUSH_CONST 26
+STORE v2
+LINE 13
+PUSH_CONST 12
+STORE v3
+LINE 14
+PUSH_CONST 500
+STORE i0
+LABEL loop_0
+LINE 15
+LOAD i0
+PUSH_CONST 0
+CMP_GT
+JMP_IF_FALSE endloop_1
+LINE 16
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c6
+PRINT
+LINE 17
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c0
+PRINT
+LINE 18
+PUSH_CONST 2
+TRANSFER c3 c5
+LINE 19
+LOAD c0
+PUSH_CONST 2
+DIV
+PUSH_CONST 93
+SUB
+PUSH_CONST 97
+MOD
+DEPOSIT c0
+LINE 20
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c3
+PRINT
+LINE 21
+PUSH_CONST 0.001
+APPLY_INTEREST c3
+LINE 22
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c3
+PRINT
+LINE 23
+PUSH_CONST 9
+TRANSFER c0 c4
+LINE 24
+LOAD i0
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 2
+DIV
+PUSH_CONST 97
+MOD
+DEPOSIT c2
+LINE 25
+LOAD i0
+PUSH_CONST 2
+DIV
+PUSH_CONST 32
+ADD
+PUSH_CONST 1000
+MOD
+STORE v2
+LINE 26
+PUSH_CONST 0.001
+APPLY_INTEREST c6
+LINE 27
+PUSH_CONST 8
+TRANSFER c5 c0
+LINE 28
+PUSH_CONST 48
+PUSH_CONST 2
+DIV
+PUSH_CONST 6
+ADD
+PUSH_CONST 97
+MOD
+DEPOSIT c2
+LINE 29
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c6
+PRINT
+LINE 30
+PUSH_CONST 1
+WITHDRAW c3
+LINE 31
+LOAD i0
+PUSH_CONST 2
+DIV
+PUSH_CONST 0.5
+MUL
+PUSH_CONST 1000
+MOD
+STORE v3
+LINE 32
+LOAD v1
+PUSH_CONST 2
+DIV
+PUSH_CONST 47
+ADD
+PUSH_CONST 1000
+MOD
+STORE v3
+LINE 33
+PUSH_CONST 8
+WITHDRAW c6
+LINE 34
+PUSH_CONST 0.001
+APPLY_INTEREST c5
+LINE 35
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c5
+PRINT
+LINE 36
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c0
+PRINT
+LINE 37
+LOAD c4
+LOAD c1
+ADD
+PUSH_CONST 2
+ADD
+PUSH_CONST 1000
+MOD
+STORE v1
+LINE 38
+PUSH_CONST 2
+TRANSFER c3 c2
+LINE 39
+PUSH_CONST 5
+WITHDRAW c5
+LINE 40
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c2
+PRINT
+LINE 41
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c2
+PRINT
+LINE 42
+LOAD i0
+PUSH_CONST 2
+DIV
+LOAD c4
+ADD
+PUSH_CONST 1000
+MOD
+STORE v3
+LINE 43
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c6
+PRINT
+LINE 44
+PUSH_CONST 9
+TRANSFER c1 c3
+LINE 45
+LOAD v0
+PUSH_CONST 2
+DIV
+LOAD c2
+SUB
+PUSH_CONST 1000
+MOD
+STORE v0
+LINE 46
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c6
+PRINT
+LINE 47
+PUSH_CONST 4
+WITHDRAW c7
+LINE 48
+LOAD i0
+LOAD i0
+ADD
+LOAD c4
+SUB
+PUSH_CONST 97
+MOD
+DEPOSIT c6
+LINE 49
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c1
+PRINT
+LINE 50
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c4
+PRINT
+LINE 51
+PUSH_CONST 0.001
+APPLY_INTEREST c4
+LINE 52
+PRINT_STR_LITERAL "Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período"
+LOAD c0
+PRINT
+LINE 53
+PUSH_CONST 3
+WITHDRAW c7
+LINE 54
+LOAD v2
+LOAD v3
+ADD
+PUSH_CONST 14
+SUB
+PUSH_CONST 1000
+MOD
+STORE v3
+LINE 55
+PUSH_CONST 0.001
+APPLY_INTEREST c4
+LINE 56
+LOAD i0
+PUSH_CONST 1
+SUB
+STORE i0
+LINE 15
+JMP loop_0
+LABEL endloop_1
+LINE 57
+PRINT_STR_LITERAL "Saldo final:"
+LOAD c0
+PRINT
+LINE 0
+HALT
@@ -0,0 +1,161 @@
+/* Generated by moneyc --emit=c; build with: cc -O2 programa.c -lm */
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static _Noreturn void money_fail(const char *kind, const char *message) {
+    fflush(stdout);
+    fprintf(stderr, "Erro %s: %s\n", kind, message);
+    exit(EXIT_FAILURE);
+}
+
+#define MONEY_JUROS 0.05
+
+static void money_print(double value) {
+    if (isnan(value)) {
+        money_fail("inesperado", "cannot convert float NaN to integer");
+    }
+    if (isinf(value)) {
+        money_fail("inesperado", "cannot convert float infinity to integer");
+    }
+    if (value == trunc(value)) {
+        printf("%.0f\n", value == 0.0 ? 0.0 : value);
+    } else {
+        printf("%.2f\n", value);
+    }
+}
+
+/* Python's float modulo: the result takes the sign of the divisor. */
+static double money_mod(double a, double b) {
+    double mod = fmod(a, b);
+    if (mod != 0.0) {
+        if ((b < 0) != (mod < 0)) {
+            mod += b;
+        }
+    } else {
+        mod = copysign(0.0, b);
+    }
+    return mod;
+}
+
+int main(void) {
+    double mv_c0 = 0.0;
+    double mv_c1 = 0.0;
+    double mv_c2 = 0.0;
+    double mv_c3 = 0.0;
+    double mv_c4 = 0.0;
+    double mv_c5 = 0.0;
+    double mv_c6 = 0.0;
+    double mv_c7 = 0.0;
+    double mv_v0 = 0.0;
+    bool md_v0 = false;
+    double mv_v1 = 0.0;
+    bool md_v1 = false;
+    double mv_v2 = 0.0;
+    bool md_v2 = false;
+    double mv_v3 = 0.0;
+    bool md_v3 = false;
+    double mv_i0 = 0.0;
+    bool md_i0 = false;
+    mv_c0 = 2301.0;
+    mv_c1 = 9425.0;
+    mv_c2 = 1133.0;
+    mv_c3 = 4279.0;
+    mv_c4 = 2031.0;
+    mv_c5 = 8217.0;
+    mv_c6 = 7464.0;
+    mv_c7 = 7837.0;
+    mv_v0 = 83.0;
+    md_v0 = true;
+    mv_v1 = 48.0;
+    md_v1 = true;
+    mv_v2 = 26.0;
+    md_v2 = true;
+    mv_v3 = 12.0;
+    md_v3 = true;
+    mv_i0 = 500.0;
+    md_i0 = true;
+    while (mv_i0 > 0.0) {
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c6);
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c0);
+        const double e0 = 2.0;
+        mv_c3 -= e0;
+        mv_c5 += e0;
+        mv_c0 += money_mod(((mv_c0 / 2.0) - 93.0), 97.0);
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c3);
+        mv_c3 += mv_c3 * 0.001;
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c3);
+        const double e1 = 9.0;
+        mv_c0 -= e1;
+        mv_c4 += e1;
+        mv_c2 += money_mod(((mv_i0 * 0.5) / 2.0), 97.0);
+        mv_v2 = money_mod(((mv_i0 / 2.0) + 32.0), 1000.0);
+        md_v2 = true;
+        mv_c6 += mv_c6 * 0.001;
+        const double e2 = 8.0;
+        mv_c5 -= e2;
+        mv_c0 += e2;
+        mv_c2 += money_mod(((48.0 / 2.0) + 6.0), 97.0);
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c6);
+        mv_c3 -= 1.0;
+        mv_v3 = money_mod(((mv_i0 / 2.0) * 0.5), 1000.0);
+        md_v3 = true;
+        mv_v3 = money_mod(((mv_v1 / 2.0) + 47.0), 1000.0);
+        md_v3 = true;
+        mv_c6 -= 8.0;
+        mv_c5 += mv_c5 * 0.001;
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c5);
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c0);
+        mv_v1 = money_mod(((mv_c4 + mv_c1) + 2.0), 1000.0);
+        md_v1 = true;
+        const double e3 = 2.0;
+        mv_c3 -= e3;
+        mv_c2 += e3;
+        mv_c5 -= 5.0;
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c2);
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c2);
+        mv_v3 = money_mod(((mv_i0 / 2.0) + mv_c4), 1000.0);
+        md_v3 = true;
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c6);
+        const double e4 = 9.0;
+        mv_c1 -= e4;
+        mv_c3 += e4;
+        mv_v0 = money_mod(((mv_v0 / 2.0) - mv_c2), 1000.0);
+        md_v0 = true;
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c6);
+        mv_c7 -= 4.0;
+        mv_c6 += money_mod(((mv_i0 + mv_i0) - mv_c4), 97.0);
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c1);
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c4);
+        mv_c4 += mv_c4 * 0.001;
+        fputs("Extrato detalhado da conta corrente com tarifas, rendimentos e lançamentos do período\n", stdout);
+        money_print(mv_c0);
+        mv_c7 -= 3.0;
+        mv_v3 = money_mod(((mv_v2 + mv_v3) - 14.0), 1000.0);
+        md_v3 = true;
+        mv_c4 += mv_c4 * 0.001;
+        mv_i0 = (mv_i0 - 1.0);
+        md_i0 = true;
+    }
+    fputs("Saldo final:\n", stdout);
+    money_print(mv_c0);
+    return 0;
+}